@@ -81,9 +81,12 @@ constexpr u8  STAT_LYC_BIT      = 6;
 
 //Graphics Data
 constexpr u8  DMA_TRANSFER_SIZE     = 0xA0;
+constexpr u16 DMA_TRANSFER_CYCLES   = 640;
 
 constexpr u16 TILE_DATA_LOW         = 0x8800;
 constexpr u16 TILE_DATA_HIGH        = 0x8000;
+constexpr u16 TILE_DATA_END         = 0x9800;
+constexpr u16 TILE_COUNT            = (TILE_DATA_END - TILE_DATA_HIGH) / 16;
 
 constexpr u8  TILE_ONE_OFFSET       = 128;
 
@@ -110,12 +113,16 @@ constexpr u8  VBLANK_HEIGHT         = 154;
 
 constexpr u32 COLOUR_BUFFER_SIZE    = SCREEN_WIDTH * SCREEN_HEIGHT;
 constexpr u32 FRAME_BUFFER_SIZE     = COLOUR_BUFFER_SIZE * 4;
+constexpr u8  FRAME_BUFFER_COUNT    = 3;
 
 //Rendering Defaults
 constexpr float TARGET_SPEED_MULTIPLIER     = 100.0f / 60.0f; // 60fps in percentage, same as '/ 60.0f * 100.0f'
 constexpr float DEFAULT_TITLE_UPDATE_RATE   = 0.5;
 constexpr u32   DEFAULT_RENDERING_SCALE     = 4;
 
+//Profiling Defaults
+constexpr u32   DEFAULT_PROFILE_INTERVAL    = 1024;
+
 //Clock and Timers
 constexpr u32 CLOCK_SPEED       = 4194304;
 
@@ -189,6 +196,15 @@ constexpr u16 UNUSABLE_END_ADDR         = 0xFF00;
 
 constexpr u16 IO_START_ADDR             = 0xFF00;
 constexpr u16 IO_END_ADDR               = 0xFF80;
+constexpr u16 IO_REGISTER_COUNT         = IO_END_ADDR - IO_START_ADDR;
+
+constexpr u16 HRAM_START_ADDR           = 0xFF80;
+constexpr u16 HRAM_END_ADDR             = 0xFFFF;
+
+constexpr u16 CODE_REGION_SIZE          = 0x0040; // Granularity the JIT tracks writes to compiled ram with
+
+constexpr u16 MEMORY_PAGE_SIZE          = 0x0100; // Granularity of the MMU's page table
+constexpr u16 MEMORY_PAGE_COUNT         = (UINT16_MAX + 1) / MEMORY_PAGE_SIZE;
 
 // IO Registers
 
@@ -287,3 +303,5 @@ constexpr u16 DE_RESET = 0x00D8;
 constexpr u16 HL_RESET = 0x014D;
 constexpr u16 SP_RESET = 0xFFFE;
 constexpr u16 PC_RESET = 0x0100;
+
+constexpr u8 BGP_RESET = 0xFC;
@@ -5,7 +5,7 @@
 #include <filesystem>
 #include <sstream>
 
-auto MBC::getCartType(const std::vector<u8>& data) -> Cart::Type
+auto MBC::getCartType(std::span<const u8> data) -> Cart::Type
 {
     u8 cartType = data[CART_TYPE];
 
@@ -44,7 +44,7 @@ auto MBC::getCartType(const std::vector<u8>& data) -> Cart::Type
     return static_cast<Cart::Type>(cartType);
 }
 
-auto MBC::getCartTitle(const std::vector<u8>& data) -> const std::string
+auto MBC::getCartTitle(std::span<const u8> data) -> const std::string
 {
     // Since the title might or might not contain null bytes,
     // copy all the possible data over, then remove anything after
@@ -72,7 +72,7 @@ auto MBC::getCartTitle(const std::vector<u8>& data) -> const std::string
     return title;
 }
 
-auto MBC::getCartRamSize(const std::vector<u8>& data) -> u32
+auto MBC::getCartRamSize(std::span<const u8> data) -> u32
 {
     switch(data[CART_RAM_SIZE])
     {
@@ -100,14 +100,9 @@ auto MBC::getCartRamSize(const std::vector<u8>& data) -> u32
     }
 }
 
-auto MBC::loadRom(const std::string& path) -> std::vector<u8>
+auto MBC::loadRom(const std::string& path) -> std::shared_ptr<const Rom>
 {
-    std::vector<u8> rom;
-    std::ifstream data(path, std::ios::in | std::ios::binary);
-    rom.assign((std::istreambuf_iterator<char>(data)), {});
-    DEBUG("Rom Size: " << std::dec << rom.size() / 1024 << "KB.");
-
-    return rom;
+    return Rom::acquire(path);
 }
 
 auto MBC::loadRam(const std::string& path) -> std::vector<u8>
@@ -124,8 +119,9 @@ auto MBC::loadRam(const std::string& path) -> std::vector<u8>
     return ram;
 }
 
-MBC::MBC(std::vector<u8>&& rom, std::vector<u8>&& ram)
-    : m_Rom(rom)
+MBC::MBC(std::shared_ptr<const Rom> rom, std::vector<u8>&& ram)
+    : m_Image(std::move(rom)), m_Rom(m_Image->getData()),
+      m_RomBank(nullptr), m_RamBank(nullptr), m_RomBankMask(0), m_RamBankMask(0), m_RomBankNumber(0)
 {
     u32 ramSize = getCartRamSize(m_Rom);
 
@@ -142,11 +138,46 @@ MBC::MBC(std::vector<u8>&& rom, std::vector<u8>&& ram)
         DEBUG("Read RAM from disk.");
         m_Ram = std::move(ram);
     }
+
+    // Carts have a power of two number of banks, so the bits of a bank number past them can be masked off
+    m_RomBankMask = std::bit_ceil(std::max<u32>(m_Rom.size() / ROM_BANK_SIZE, 1)) - 1;
+    m_RamBankMask = std::bit_ceil(std::max<u32>(m_Ram.size() / RAM_BANK_SIZE, 1)) - 1;
+
+    mapBanks(1, 0);
 }
 
 MBC::~MBC() = default;
 
-auto MBC::getRam() -> const std::vector<u8>&
+auto MBC::getRam() const -> const std::vector<u8>&
 {
     return m_Ram;
 }
+
+auto MBC::getRomBank() const -> u16
+{
+    return m_RomBankNumber;
+}
+
+void MBC::mapBanks(u32 romBank, u32 ramBank)
+{
+    u32 romBanks = m_Rom.size() / ROM_BANK_SIZE;
+    u32 ramBanks = m_Ram.size() / RAM_BANK_SIZE;
+
+    // Roms that aren't a power of two banks long still have to wrap somewhere
+    romBank &= m_RomBankMask;
+    if(romBank >= romBanks) romBank = romBanks ? romBank % romBanks : 0;
+
+    ramBank &= m_RamBankMask;
+    if(ramBank >= ramBanks) ramBank = ramBanks ? ramBank % ramBanks : 0;
+
+    m_RomBankNumber = static_cast<u16>(romBank);
+    m_RomBank = romBanks ? m_Rom.data() + romBank * ROM_BANK_SIZE : nullptr;
+    m_RamBank = ramBanks ? m_Ram.data() + ramBank * RAM_BANK_SIZE : nullptr;
+}
+
+auto MBC::getRomData(u16 bank) const -> const u8*
+{
+    if((bank + 1U) * ROM_BANK_SIZE > m_Rom.size()) return nullptr;
+
+    return m_Rom.data() + bank * ROM_BANK_SIZE;
+}
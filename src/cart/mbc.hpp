@@ -3,12 +3,16 @@
 #include "core.hpp"
 
 #include <algorithm>
+#include <bit>
 #include <filesystem>
 #include <fstream>
 #include <iterator>
+#include <span>
 #include <string>
 #include <vector>
 
+#include "rom.hpp"
+
 namespace Cart
 {
     enum Type
@@ -44,6 +48,11 @@ namespace Cart
     };
 }
 
+/**
+ * The state every cartridge has. Each MBC adds read and write, which the MMU
+ * calls through a std::variant instead of virtual functions, so that the calls
+ * can be inlined.
+**/
 class MBC
 {
     public:
@@ -52,28 +61,28 @@ class MBC
          * 
          * @param data The rom's data
          */
-        [[nodiscard]] static auto getCartType(const std::vector<u8>& data) -> Cart::Type;
+        [[nodiscard]] static auto getCartType(std::span<const u8> data) -> Cart::Type;
 
         /**
          * @brief Get the title of the cart
          * 
          * @param data The rom's data
          */
-        [[nodiscard]] static auto getCartTitle(const std::vector<u8>& data) -> const std::string;
+        [[nodiscard]] static auto getCartTitle(std::span<const u8> data) -> const std::string;
 
         /**
          * @brief Get the amount of ram a cart supports
          * 
          * @param data The rom's data
          */
-        [[nodiscard]] static auto getCartRamSize(const std::vector<u8>& data) -> u32;
+        [[nodiscard]] static auto getCartRamSize(std::span<const u8> data) -> u32;
 
         /**
          * @brief Load a rom into memory
          * 
          * @param path The path to the rom
          */
-        [[nodiscard]] static auto loadRom(const std::string& path) -> std::vector<u8>;
+        [[nodiscard]] static auto loadRom(const std::string& path) -> std::shared_ptr<const Rom>;
 
         /**
          * @brief Load ram data into memory
@@ -82,31 +91,51 @@ class MBC
          */
         [[nodiscard]] static auto loadRam(const std::string& path) -> std::vector<u8>;
     public:
-        MBC(std::vector<u8>&& rom, std::vector<u8>&& ram);
-        virtual ~MBC();
+        MBC(std::shared_ptr<const Rom> rom, std::vector<u8>&& ram);
+        ~MBC();
+
+        // The banks point into the cartridge itself
+        MBC(const MBC&) = delete;
+        auto operator=(const MBC&) -> MBC& = delete;
 
         /**
-         * @brief Reads a byte from the specified memory address
+         * @brief Gets the rom bank currently mapped to 0x4000 - 0x7FFF
          * 
-         * @param address The address to read from
-         * @return The value stored at that address
+         * @return The bank, after wrapping it around the banks the rom has
          */
-        [[nodiscard]] virtual auto read(u16 address) const -> u8 = 0;
+        [[nodiscard]] auto getRomBank() const -> u16;
 
         /**
-         * @brief Writes a byte at the specified memory address
+         * @brief Gets the ram of the cartridge (mainly for saving)
          * 
-         * @param address The address to write to
-         * @param val The value to write
          */
-        virtual void write(u16 address, u8 val) = 0;
+        [[nodiscard]] auto getRam() const -> const std::vector<u8>&;
 
         /**
-         * @brief Gets the ram of the cartridge (mainly for saving)
+         * @brief Gets the data of a rom bank, so it can be read without going through the MBC
          * 
+         * @param bank The rom bank
+         * @return The start of the bank, or nullptr if the rom doesn't have that bank
          */
-        [[nodiscard]] auto getRam() -> const std::vector<u8>&;
+        [[nodiscard]] auto getRomData(u16 bank) const -> const u8*;
     protected:
-        std::vector<u8> m_Rom;
+        /**
+         * @brief Maps the banks the MBC selected to 0x4000 - 0x7FFF and 0xA000 - 0xBFFF.
+         * Like on hardware, bank bits the cart doesn't have are ignored
+         * 
+         * @param romBank The selected rom bank
+         * @param ramBank The selected ram bank
+         */
+        void mapBanks(u32 romBank, u32 ramBank);
+    protected:
+        std::shared_ptr<const Rom> m_Image;  // Shared by every instance with the same rom
+        std::span<const u8> m_Rom;
         std::vector<u8> m_Ram;
+
+        const u8* m_RomBank;    // The start of the rom bank mapped to 0x4000 - 0x7FFF
+        u8* m_RamBank;          // The start of the ram bank mapped to 0xA000 - 0xBFFF, nullptr without ram
+    private:
+        u32 m_RomBankMask;
+        u32 m_RamBankMask;
+        u16 m_RomBankNumber;
 };
@@ -1,9 +1,8 @@
 #include "core.hpp"
 
 #include "mbc1.hpp"
-#include <stdexcept>
 
-MBC1::MBC1(std::vector<u8>&& rom, std::vector<u8>&& ram)
+MBC1::MBC1(std::shared_ptr<const Rom> rom, std::vector<u8>&& ram)
     : MBC(std::move(rom), std::move(ram)),
       m_RomBankNumber(1), m_RamBankNumber(0), m_RamEnabled(false) {}
 
@@ -15,27 +14,10 @@ auto MBC1::read(u16 address) const -> u8
     {
         case 0x4000:
         case 0x6000:
-            try
-            {
-                return m_Rom.at((address - ROM_BANK_OFFSET) + ROM_BANK_SIZE * m_RomBankNumber);
-            }
-            catch(std::out_of_range&)
-            {
-                ERROR("Tried to read out of bounds from ROM at address 0x" << std::setw(4) << std::hex << address << "!");
-            }
-            return 0xFF;
+            return m_RomBank[address - ROM_BANK_OFFSET];
 
         case 0xA000:
-            try
-            {
-                return m_Ram.at((address - RAM_BANK_OFFSET) + RAM_BANK_SIZE * m_RamBankNumber);
-            }
-            catch(std::out_of_range&)
-            {
-                ERROR("Tried to read out of bounds from RAM at address 0x"
-                      << std::setw(4) << std::hex << address << "!");
-            }
-            return 0xFF;
+            return m_RamBank ? m_RamBank[address - RAM_BANK_OFFSET] : 0xFF;
             
         default:
             return m_Rom[address];
@@ -57,26 +39,20 @@ void MBC1::write(u16 address, u8 val)
             {
                 m_RomBankNumber++;
             }
+
+            mapBanks(m_RomBankNumber, m_RamBankNumber);
             break;
         case 0x4000:
             if(val <= 0x03) m_RamBankNumber = (val & 0x03);
+
+            mapBanks(m_RomBankNumber, m_RamBankNumber);
             break;
         case 0x6000:
             break;
         case 0xA000:
-            if(m_RamEnabled)
+            if(m_RamEnabled && m_RamBank)
             {
-                try
-                {
-                    m_Ram.at((address - RAM_BANK_OFFSET) + RAM_BANK_SIZE * m_RamBankNumber) = val;
-                }
-                catch(std::out_of_range&)
-                {
-                    ERROR("Tried to write 0x" << std::setw(2) << std::setfill('0')
-                          << std::hex << static_cast<u32>(val)
-                          << " out of bounds from RAM at address 0x"
-                          << std::setw(4) << std::setfill('0') << std::hex << address << "!");
-                }
+                m_RamBank[address - RAM_BANK_OFFSET] = val;
             }
     }
 }
@@ -2,7 +2,7 @@
 
 #include "mbc3.hpp"
 
-MBC3::MBC3(std::vector<u8>&& rom, std::vector<u8>&& ram)
+MBC3::MBC3(std::shared_ptr<const Rom> rom, std::vector<u8>&& ram)
     : MBC(std::move(rom), std::move(ram)),
       m_RomBankNumber(1), m_RamBankNumber(0),
       m_RamEnabled(false), m_RTCEnabled(false) {}
@@ -18,9 +18,9 @@ auto MBC3::read(u16 address) const -> u8
             return m_Rom[address];
         case 0x4000:
         case 0x6000:
-            return m_Rom[(address - ROM_BANK_OFFSET) + ROM_BANK_SIZE * m_RomBankNumber];
+            return m_RomBank[address - ROM_BANK_OFFSET];
         case 0xA000:
-            return m_Ram[(address - RAM_BANK_OFFSET) + RAM_BANK_SIZE * m_RamBankNumber];
+            return m_RamBank ? m_RamBank[address - RAM_BANK_OFFSET] : 0xFF;
         default:
             WARN("Trying to read from address 0x" << std::hex << std::setw(4) << std::setfill('0') << address << '!');
             return 0xFF;
@@ -38,12 +38,14 @@ void MBC3::write(u16 address, u8 val)
         case 0x2000: // ROM Bank Switching
             if(val == 0x00) { val = 0x01; }
             m_RomBankNumber = (val & 0x7F);
+            mapBanks(m_RomBankNumber, m_RamBankNumber);
             break;
         case 0x4000: // RAM Bank Switching
             if(val <= 0x03)
             {
                 m_RamBankNumber = val;
                 m_RTCEnabled = false;
+                mapBanks(m_RomBankNumber, m_RamBankNumber);
             }
             else if(0x80 <= val && val <= 0x0C)
             {
@@ -62,7 +64,7 @@ void MBC3::write(u16 address, u8 val)
             }
             else
             {
-                m_Ram[(address - RAM_BANK_OFFSET) + RAM_BANK_SIZE * m_RamBankNumber] = val;
+                if(m_RamBank) m_RamBank[address - RAM_BANK_OFFSET] = val;
             }
             break;
         default:
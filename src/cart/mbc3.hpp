@@ -7,8 +7,8 @@
 class MBC3 final : public MBC
 {
     public:
-        MBC3(std::vector<u8>&& rom, std::vector<u8>&& ram);
-        ~MBC3() final;
+        MBC3(std::shared_ptr<const Rom> rom, std::vector<u8>&& ram);
+        ~MBC3();
         
         /**
          * @brief Reads a byte from the specified memory address
@@ -16,7 +16,7 @@ class MBC3 final : public MBC
          * @param address The address to read from
          * @return The value stored at that address
          */
-        [[nodiscard]] virtual auto read(u16 address) const -> u8 final;
+        [[nodiscard]] auto read(u16 address) const -> u8;
 
         /**
          * @brief Writes a byte at the specified memory address
@@ -24,7 +24,7 @@ class MBC3 final : public MBC
          * @param address The address to write to
          * @param val The value to write
          */
-        virtual void write(u16 address, u8 val) final;
+        void write(u16 address, u8 val);
     private:
         u8 m_RomBankNumber;
         u8 m_RamBankNumber;
@@ -2,10 +2,13 @@
 
 #include "mbc5.hpp"
 
-MBC5::MBC5(std::vector<u8>&& rom, std::vector<u8>&& ram)
+MBC5::MBC5(std::shared_ptr<const Rom> rom, std::vector<u8>&& ram)
     : MBC(std::move(rom), std::move(ram)),
       m_RomBankNumber(0), m_RamBankNumber(0),
-      m_RamEnabled(false), m_RTCEnabled(false) {}
+      m_RamEnabled(false), m_RTCEnabled(false)
+{
+    mapBanks(m_RomBankNumber, m_RamBankNumber);
+}
 
 MBC5::~MBC5() = default;
 
@@ -18,9 +21,9 @@ auto MBC5::read(u16 address) const -> u8
             return m_Rom[address];
         case 0x4000:
         case 0x6000:
-            return m_Rom[(address - ROM_BANK_OFFSET) + ROM_BANK_SIZE * m_RomBankNumber];
+            return m_RomBank[address - ROM_BANK_OFFSET];
         case 0xA000:
-            return m_Ram[(address - RAM_BANK_OFFSET) + RAM_BANK_SIZE * m_RamBankNumber];
+            return m_RamBank ? m_RamBank[address - RAM_BANK_OFFSET] : 0xFF;
         default:
             WARN("Trying to read from address 0x" << std::hex << std::setw(4) << std::setfill('0') << address << '!');
             return 0xFF;
@@ -37,15 +40,18 @@ void MBC5::write(u16 address, u8 val)
             break;
         case 0x2000: // ROM Bank Switching: Bits 0-7
             m_RomBankNumber = (m_RomBankNumber & 0x10) | val;
+            mapBanks(m_RomBankNumber, m_RamBankNumber);
             break;
         case 0x3000: // Rom Bank Switching: Bit 8
             if(val) { m_RomBankNumber = m_RomBankNumber | 0b100000000; }
+            mapBanks(m_RomBankNumber, m_RamBankNumber);
             break;
         case 0x4000: // RAM Bank Switching
             if(val <= 0x03)
             {
                 m_RamBankNumber = val;
                 m_RTCEnabled = false;
+                mapBanks(m_RomBankNumber, m_RamBankNumber);
             }
             else if(0x80 <= val && val <= 0x0C)
             {
@@ -64,7 +70,7 @@ void MBC5::write(u16 address, u8 val)
             }
             else
             {
-                m_Ram[(address - RAM_BANK_OFFSET) + RAM_BANK_SIZE * m_RamBankNumber] = val;
+                if(m_RamBank) m_RamBank[address - RAM_BANK_OFFSET] = val;
             }
             break;
         default:
@@ -0,0 +1,146 @@
+#include "core.hpp"
+
+#include "rom.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <unordered_map>
+
+#ifdef MAPPED_ROMS
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+constexpr u64 FNV_OFFSET_BASIS = 0xCBF29CE484222325;
+constexpr u64 FNV_PRIME        = 0x00000100000001B3;
+
+auto Rom::acquire(const std::string& path) -> std::shared_ptr<const Rom>
+{
+    // Images are keyed by their contents, as the same rom can be under different paths
+    static std::mutex mutex;
+    static std::unordered_map<u64, std::weak_ptr<const Rom>> images;
+
+    auto rom = std::make_shared<const Rom>(path);
+    u64 hash = getHash(rom->getData());
+
+    std::lock_guard lock(mutex);
+    std::erase_if(images, [](const auto& image) { return image.second.expired(); });
+
+    auto it = images.find(hash);
+    if(it != images.end())
+    {
+        auto image = it->second.lock();
+        if(image && std::ranges::equal(image->getData(), rom->getData()))
+        {
+            DEBUG("Sharing the rom image of another instance.");
+            return image;
+        }
+    }
+
+    images[hash] = rom;
+    return rom;
+}
+
+auto Rom::getHash(std::span<const u8> data) -> u64
+{
+    u64 hash = FNV_OFFSET_BASIS;
+    for(u8 byte : data)
+    {
+        hash = (hash ^ byte) * FNV_PRIME;
+    }
+
+    return hash;
+}
+
+Rom::Rom(const std::string& path)
+    : m_Mapped(false)
+{
+    if(map(path))
+    {
+        DEBUG("Mapped rom, Rom Size: " << std::dec << m_Data.size() / 1024 << "KB.");
+        return;
+    }
+
+    std::error_code error;
+    auto size = std::filesystem::file_size(path, error);
+    if(error) size = 0;
+
+    m_Buffer.resize(size);
+    std::ifstream data(path, std::ios::in | std::ios::binary);
+    data.read(reinterpret_cast<char*>(m_Buffer.data()), static_cast<std::streamsize>(size));
+    m_Buffer.resize(static_cast<size_t>(data.gcount()));
+
+    m_Data = m_Buffer;
+    DEBUG("Read rom, Rom Size: " << std::dec << m_Data.size() / 1024 << "KB.");
+}
+
+Rom::~Rom()
+{
+    unmap();
+}
+
+Rom::Rom(Rom&& other) noexcept
+    : m_Data(other.m_Data), m_Mapped(other.m_Mapped), m_Buffer(std::move(other.m_Buffer))
+{
+    // Moving the buffer keeps its data where it is, so the span stays valid
+    other.m_Data   = {};
+    other.m_Mapped = false;
+}
+
+auto Rom::operator=(Rom&& other) noexcept -> Rom&
+{
+    if(this != &other)
+    {
+        unmap();
+
+        m_Data   = other.m_Data;
+        m_Mapped = other.m_Mapped;
+        m_Buffer = std::move(other.m_Buffer);
+
+        other.m_Data   = {};
+        other.m_Mapped = false;
+    }
+
+    return *this;
+}
+
+auto Rom::map([[maybe_unused]] const std::string& path) -> bool
+{
+    #ifdef MAPPED_ROMS
+        int file = open(path.c_str(), O_RDONLY);
+        if(file < 0) return false;
+
+        struct stat info {};
+        if(fstat(file, &info) != 0 || info.st_size <= 0)
+        {
+            close(file);
+            return false;
+        }
+
+        void* data = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+        close(file); // The mapping keeps the file open
+
+        if(data == MAP_FAILED) return false;
+
+        m_Data   = { static_cast<const u8*>(data), static_cast<size_t>(info.st_size) };
+        m_Mapped = true;
+        return true;
+    #else
+        return false;
+    #endif
+}
+
+void Rom::unmap()
+{
+    #ifdef MAPPED_ROMS
+        if(m_Mapped)
+        {
+            munmap(const_cast<u8*>(m_Data.data()), m_Data.size());
+            m_Mapped = false;
+        }
+    #endif
+}
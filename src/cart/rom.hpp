@@ -0,0 +1,109 @@
+#pragma once
+
+#include "core.hpp"
+
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+/**
+ * The read only data of a rom. Where possible the file is mapped into memory
+ * instead of being read, so pages are only loaded once they are touched and
+ * are shared with every other process that has the same rom open.
+ * 
+ * Within a process, every Gameboy running the same rom shares one image,
+ * see Rom::acquire.
+**/
+class Rom
+{
+    public:
+        /**
+         * @brief Gets the image of a rom, shared with every other instance that
+         * has a rom with the same contents loaded
+         * 
+         * @param path The filepath to the rom
+         * @return The image, which is unloaded once the last instance drops it
+         */
+        [[nodiscard]] static auto acquire(const std::string& path) -> std::shared_ptr<const Rom>;
+
+        /**
+         * @brief Maps a rom, or reads it into memory if it can't be mapped
+         * 
+         * @param path The filepath to the rom
+         */
+        explicit Rom(const std::string& path);
+        ~Rom();
+
+        Rom(Rom&& other) noexcept;
+        auto operator=(Rom&& other) noexcept -> Rom&;
+
+        Rom(const Rom&) = delete;
+        auto operator=(const Rom&) -> Rom& = delete;
+
+        /**
+         * @brief Reads a byte of the rom
+         * 
+         * @param address The offset into the rom
+         * @return The value stored at that offset
+         */
+        [[nodiscard]] __always_inline auto operator[](u32 address) const -> u8;
+
+        /**
+         * @brief Gets the size of the rom
+         * 
+         * @return The size in bytes
+         */
+        [[nodiscard]] __always_inline auto size() const -> u32;
+
+        /**
+         * @brief Gets all of the rom's data
+         * 
+         * @return The data, valid for as long as the rom is
+         */
+        [[nodiscard]] __always_inline auto getData() const -> std::span<const u8>;
+    private:
+        /**
+         * @brief Hashes the contents of a rom
+         * 
+         * @param data The rom's data
+         * @return The 64 bit FNV-1a hash of the data
+         */
+        [[nodiscard]] static auto getHash(std::span<const u8> data) -> u64;
+
+        /**
+         * @brief Maps a rom read only
+         * 
+         * @param path The filepath to the rom
+         * @return If the rom could be mapped
+         */
+        auto map(const std::string& path) -> bool;
+
+        /**
+         * @brief Unmaps the rom if it is mapped
+         * 
+         */
+        void unmap();
+    private:
+        std::span<const u8> m_Data;
+
+        bool m_Mapped;
+        std::vector<u8> m_Buffer;   // Only used if the rom couldn't be mapped
+};
+
+//--------------------------  Inline function implementations --------------------------//
+
+__always_inline auto Rom::operator[](u32 address) const -> u8
+{
+    return m_Data[address];
+}
+
+__always_inline auto Rom::size() const -> u32
+{
+    return static_cast<u32>(m_Data.size());
+}
+
+__always_inline auto Rom::getData() const -> std::span<const u8>
+{
+    return m_Data;
+}
@@ -2,7 +2,7 @@
 
 #include "romonly.hpp"
 
-RomOnly::RomOnly(std::vector<u8>&& rom)
+RomOnly::RomOnly(std::shared_ptr<const Rom> rom)
     : MBC(std::move(rom), {}) {}
 RomOnly::~RomOnly() = default;
 
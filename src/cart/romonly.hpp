@@ -7,8 +7,8 @@
 class RomOnly final : public MBC
 {
     public:
-        RomOnly(std::vector<u8>&& rom);
-        ~RomOnly() final;
+        RomOnly(std::shared_ptr<const Rom> rom);
+        ~RomOnly();
         
         /**
          * @brief Reads a byte from the specified memory address
@@ -16,7 +16,7 @@ class RomOnly final : public MBC
          * @param address The address to read from
          * @return The value stored at that address
          */
-        [[nodiscard]] virtual auto read(u16 address) const -> u8 final;
+        [[nodiscard]] auto read(u16 address) const -> u8;
 
         /**
          * @brief Writes a byte at the specified memory address
@@ -24,5 +24,5 @@ class RomOnly final : public MBC
          * @param address The address to write to
          * @param val The value to write
          */
-        virtual void write(u16 address, u8 val) final;
+        void write(u16 address, u8 val);
 };
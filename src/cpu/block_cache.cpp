@@ -0,0 +1,263 @@
+#include "core.hpp"
+
+#include "block_cache.hpp"
+
+#include "gameboy.hpp"
+
+#include "jit.hpp"
+
+#include <algorithm>
+
+constexpr u32 MAX_RECORDS   = 0x40000;
+constexpr u8  HOT_THRESHOLD = 16;
+
+/**
+ * @brief Checks if an instruction has to be the last in a block, either
+ * because it can change PC or because it changes when interrupts are taken
+ *
+ * @param opcode The opcode of the instruction
+ * @return If the instruction ends the block
+ */
+static auto endsBlock(u8 opcode) -> bool
+{
+    switch(opcode)
+    {
+        case 0x10: // STOP
+        case 0x76: // HALT
+        case 0xF3: // DI
+        case 0xFB: // EI
+        case 0x18: case 0x20: case 0x28: case 0x30: case 0x38: // JR
+        case 0xC2: case 0xC3: case 0xCA: case 0xD2: case 0xDA: case 0xE9: // JP
+        case 0xC4: case 0xCC: case 0xCD: case 0xD4: case 0xDC: // CALL
+        case 0xC0: case 0xC8: case 0xC9: case 0xD0: case 0xD8: case 0xD9: // RET(I)
+        case 0xC7: case 0xCF: case 0xD7: case 0xDF: case 0xE7: case 0xEF: case 0xF7: case 0xFF: // RST
+            return true;
+        default:
+            return false;
+    }
+}
+
+BlockCache::BlockCache(CPU& cpu, Gameboy& gb)
+    : m_CPU(cpu), m_Gameboy(gb)
+{
+    DEBUG("Initializing block cache.");
+    m_Records.reserve(MAX_RECORDS);
+}
+
+BlockCache::~BlockCache() = default;
+
+auto BlockCache::setJIT(bool enabled) -> bool
+{
+    #ifdef JIT_RECOMPILER
+        flush();
+
+        if(!enabled)
+        {
+            m_JIT.reset();
+            return true;
+        }
+
+        if(!m_JIT)
+        {
+            m_JIT = std::make_unique<JIT>(m_CPU);
+        }
+
+        if(!m_JIT->isValid())
+        {
+            m_JIT.reset();
+            return false;
+        }
+
+        return true;
+    #else
+        return !enabled;
+    #endif
+}
+
+auto BlockCache::run(u16 address) -> u8
+{
+    u32 key;
+    u32 end;
+
+    if(!getRegion(address, key, end)) return 0;
+
+    auto it = m_Blocks.find(key);
+
+    if(it == m_Blocks.end())
+    {
+        if(m_Records.size() + MAX_BLOCK_INSTRUCTIONS > MAX_RECORDS)
+        {
+            DEBUG("Block cache is full, flushing.");
+            flush();
+        }
+
+        it = m_Blocks.emplace(key, decode(address, end, key)).first;
+    }
+
+    Block& block = it->second;
+    if(!block.count) return 0;
+
+    // Records are only freed by a flush, so these stay valid even if the block invalidates itself
+    const Record* records = &m_Records[block.first];
+    m_CPU.m_BlockInvalidated = false;
+
+    #ifdef JIT_RECOMPILER
+        if(m_JIT && !block.code && ++block.hits >= HOT_THRESHOLD)
+        {
+            block.code = m_JIT->compile(records, block.count);
+
+            if(!block.code)
+            {
+                DEBUG("JIT code buffer is full, flushing.");
+                flush();
+                return 0;
+            }
+        }
+
+        u8 last = block.code ? block.code(m_CPU) : execute(records, block.count);
+    #else
+        u8 last = execute(records, block.count);
+    #endif
+
+    u8 cycles = m_CPU.m_Branched ? records[last].cyclesBranch : records[last].cyclesNoBranch;
+    m_CPU.m_Branched = false;
+
+    return cycles;
+}
+
+void BlockCache::invalidate(u16 address)
+{
+    auto region = m_RamBlocks.find(address / CODE_REGION_SIZE);
+    if(region == m_RamBlocks.end()) return;
+
+    for(u32 key : region->second)
+    {
+        m_Blocks.erase(key);
+    }
+
+    m_RamBlocks.erase(region);
+}
+
+auto BlockCache::getRegion(u16 address, u32& key, u32& end) const -> bool
+{
+    key = address;
+
+    if(address < ROM_BANK_OFFSET)
+    {
+        if(address < BOOT_ROM_SIZE && m_Gameboy.isBootEnabled()) return false;
+
+        end = ROM_BANK_OFFSET;
+    }
+    else if(address < ROM_END_ADDR)
+    {
+        key |= static_cast<u32>(m_Gameboy.getRomBank()) << 16; //NOLINT(cppcoreguidelines-avoid-magic-numbers)
+        end = ROM_END_ADDR;
+    }
+    else if(INTERNAL_RAM_START_ADDR <= address && address < INTERNAL_RAM_END_ADDR)
+    {
+        end = INTERNAL_RAM_END_ADDR;
+    }
+    else if(HRAM_START_ADDR <= address && address < HRAM_END_ADDR)
+    {
+        end = HRAM_END_ADDR;
+    }
+    else
+    {
+        return false; // VRAM, cartridge ram and echo ram are left to the interpreter
+    }
+
+    return true;
+}
+
+auto BlockCache::decode(u16 address, u32 end, u32 key) -> Block
+{
+    Block block { static_cast<u32>(m_Records.size()), 0, 0, nullptr };
+
+    u32 pc     = address;
+    u8  cycles = 0;
+    bool done  = false;
+
+    while(!done && block.count < MAX_BLOCK_INSTRUCTIONS)
+    {
+        u8 opcode = m_Gameboy.read(pc);
+        u8 extraCycles = 0;
+
+        const Instruction* instruction = &CPU::instructions[opcode];
+        CPU::Handler handler           = CPU::handlers[opcode];
+        u16 immediate                  = 0;
+
+        if(opcode == CB_OPCODE)
+        {
+            if(pc + 1 >= end) break;
+
+            u8 opcodeCB = m_Gameboy.read(pc + 1);
+            instruction = &CPU::instructionsCB[opcodeCB];
+            handler     = CPU::handlersCB[opcodeCB];
+            extraCycles = 4;
+        }
+
+        if(!handler || pc + instruction->length > end) break;
+
+        u8 worstCycles = extraCycles + std::max(instruction->cyclesBranch, instruction->cyclesNoBranch);
+        if(cycles + worstCycles > MAX_BLOCK_CYCLES) break;
+
+        if(opcode != CB_OPCODE && instruction->length > 1)
+        {
+            immediate = m_Gameboy.read(pc + 1);
+
+            if(instruction->length > 2)
+            {
+                immediate |= m_Gameboy.read(pc + 2) << CHAR_BIT;
+            }
+        }
+
+        pc += instruction->length;
+
+        // Every instruction before this one fell through, since anything that can branch ends the block
+        Record record { handler, immediate, static_cast<u16>(pc),
+                        static_cast<u8>(cycles + extraCycles + instruction->cyclesBranch),
+                        static_cast<u8>(cycles + extraCycles + instruction->cyclesNoBranch) };
+
+        m_Records.push_back(record);
+        cycles = record.cyclesNoBranch;
+
+        block.count++;
+        done = (opcode != CB_OPCODE && endsBlock(opcode));
+    }
+
+    if(address >= INTERNAL_RAM_START_ADDR && block.count)
+    {
+        for(u32 region = address / CODE_REGION_SIZE; region <= (pc - 1) / CODE_REGION_SIZE; ++region)
+        {
+            m_Gameboy.markCode(region * CODE_REGION_SIZE);
+            m_RamBlocks[region].push_back(key);
+        }
+    }
+
+    return block;
+}
+
+auto BlockCache::execute(const Record* records, u8 count) -> u8
+{
+    for(u8 index = 0;; ++index)
+    {
+        const Record& record = records[index];
+
+        m_CPU.m_Registers.PC() = record.next;
+        m_CPU.m_Immediate      = record.immediate;
+        record.handler(m_CPU);
+
+        if(index + 1 == count || m_CPU.m_BlockInvalidated) return index;
+    }
+}
+
+void BlockCache::flush()
+{
+    m_Blocks.clear();
+    m_RamBlocks.clear();
+    m_Records.clear();
+
+    #ifdef JIT_RECOMPILER
+        if(m_JIT) m_JIT->flush();
+    #endif
+}
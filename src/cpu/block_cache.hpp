@@ -0,0 +1,132 @@
+#pragma once
+
+#include "core.hpp"
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "cpu.hpp"
+
+class Gameboy;
+class JIT;
+
+// Keeps a block plus an interrupt dispatch (20 cycles) within an OAM scan,
+// so the PPU never has more than one mode change pending after a block
+constexpr u8  MAX_BLOCK_CYCLES       = CYCLES_PER_OAM_SCAN - 24;
+constexpr u8  MAX_BLOCK_INSTRUCTIONS = MAX_BLOCK_CYCLES / 4;
+
+/**
+ * Decodes runs of instructions ending in a jump, call, return, HALT, STOP,
+ * EI or DI into records once, then runs them back to back without fetching
+ * the opcodes and immediates through the MMU again.
+ *
+ * Blocks are cached per (bank, PC). Blocks from a switchable rom bank are keyed
+ * by the bank they were decoded from, so a bank switch simply selects other
+ * blocks, while blocks decoded from ram are thrown away once the ram is written.
+ * Either one stops the block that is running after the current instruction.
+**/
+class BlockCache
+{
+    public:
+        /**
+         * A decoded instruction. The cycles are counted from the start of
+         * the block, so a block took the cycles of the last record that ran
+        **/
+        struct Record
+        {
+            CPU::Handler handler;
+            u16 immediate;
+            u16 next;           // The address of the following instruction
+            u8 cyclesBranch;
+            u8 cyclesNoBranch;
+        };
+
+        /**
+         * Compiled code for a block, returning the index of the last record it ran
+        **/
+        using Code = auto (*)(CPU&) -> u8;
+    public:
+        BlockCache(CPU& cpu, Gameboy& gb);
+        ~BlockCache();
+
+        BlockCache(const BlockCache&) = delete;
+        auto operator=(const BlockCache&) -> BlockCache& = delete;
+
+        /**
+         * @brief Turns compiling hot blocks to x86-64 code on or off
+         *
+         * @param enabled If the JIT should be used
+         * @return If the JIT is in the requested state
+         */
+        auto setJIT(bool enabled) -> bool;
+
+        /**
+         * @brief Runs the block starting at an address, decoding it if it isn't cached
+         *
+         * @param address The address of the first instruction of the block
+         * @return The number of cycles the block took, or 0 if it has to be interpreted
+         */
+        auto run(u16 address) -> u8;
+
+        /**
+         * @brief Throws away every block decoded from the region of ram containing an address
+         *
+         * @param address The address that was written to
+         */
+        void invalidate(u16 address);
+    private:
+        struct Block
+        {
+            u32 first;          // Index of the first record
+            u8 count;
+            u8 hits;
+            Code code;
+        };
+
+        /**
+         * @brief Gets the cache key of a block and the end of the memory it may span
+         *
+         * @param address The address of the first instruction of the block
+         * @param key The (bank, PC) key of the block
+         * @param end The first address the block cannot reach into
+         * @return If code at the address can be cached
+         */
+        auto getRegion(u16 address, u32& key, u32& end) const -> bool;
+
+        /**
+         * @brief Decodes the block starting at an address
+         *
+         * @param address The address of the first instruction of the block
+         * @param end The first address the block cannot reach into
+         * @param key The (bank, PC) key of the block
+         * @return The decoded block, with no records if the first instruction can't be decoded
+         */
+        auto decode(u16 address, u32 end, u32 key) -> Block;
+
+        /**
+         * @brief Runs decoded records until the last one or until the block is invalidated
+         *
+         * @param records The records of the block
+         * @param count The number of records
+         * @return The index of the last record that ran
+         */
+        auto execute(const Record* records, u8 count) -> u8;
+
+        /**
+         * @brief Throws away every block
+         *
+         */
+        void flush();
+    private:
+        CPU& m_CPU;
+        Gameboy& m_Gameboy;
+
+        std::vector<Record> m_Records;
+        std::unordered_map<u32, Block> m_Blocks;
+        std::unordered_map<u16, std::vector<u32>> m_RamBlocks; // Blocks decoded from each region of ram
+
+        #ifdef JIT_RECOMPILER
+        std::unique_ptr<JIT> m_JIT;
+        #endif
+};
@@ -4,16 +4,26 @@
 
 #include "gameboy.hpp"
 
+#include "block_cache.hpp"
+
+#include "logging/profiler.hpp"
+
+#include <algorithm>
+
 #ifdef NDEBUG
     #define LOG_OP() ((void)0) //NOLINT(cppcoreguidelines-macro-usage)
 #else
-    #define LOG_OP() OPCODE(instruction.mnemonic) //NOLINT(cppcoreguidelines-macro-usage)
+    #define LOG_OP() OPCODE(instruction->mnemonic) //NOLINT(cppcoreguidelines-macro-usage)
 #endif
 
 CPU::CPU(Gameboy& gb)
     : m_Registers({}), m_Gameboy(gb),
       m_Halted(false), m_HaltBug(false),
-      m_IME(false), m_Branched(false)
+      m_IME(false), m_Branched(false), m_Interpreter(Interpreter::Table),
+      m_PendingFlags({ FlagOp::None, 0, 0, false, 0 }),
+      m_Immediate(0), m_BlockInvalidated(false),
+      m_Writes(0), m_IdleState({}), m_IdleCycles(0), m_IdleValid(false),
+      m_MemoryLoop(nullptr)
 {
     DEBUG("Initializing CPU.");
 }
@@ -54,6 +64,8 @@ void CPU::reset()
     m_IME      = false;
     m_Branched = false;
 
+    m_PendingFlags.op = FlagOp::None;
+
     m_Gameboy.resetDiv();
     m_Gameboy.write(TIMER_TIMA_REGISTER, 0);
 }
@@ -68,13 +80,41 @@ void CPU::setIME(bool ime)
     m_IME = ime;
 }
 
+auto CPU::getPC() const -> u16
+{
+    return m_Registers.PC();
+}
+
+auto CPU::isHalted() const -> bool
+{
+    return m_Halted;
+}
+
+void CPU::fetchImmediate(u8 length)
+{
+    switch(length)
+    {
+        case 2:
+            m_Immediate = m_Gameboy.read(m_Registers.PC()++);
+            break;
+        case 3:
+            m_Immediate  = m_Gameboy.read(m_Registers.PC()++);
+            m_Immediate |= m_Gameboy.read(m_Registers.PC()++) << CHAR_BIT;
+            break;
+        default:
+            break;
+    }
+}
+
 auto CPU::tick() -> u8
 {
     if(m_Halted) return 4; // Halted CPU takes 4 cycles
 
-    Instruction instruction;
+    const Instruction* instruction;
+    Handler handler;
     u8 cycles = 0;
     u8 opcode = m_Gameboy.read(m_Registers.PC());
+    PROFILE_OPCODE(opcode);
 
     if(!m_HaltBug)
     {
@@ -88,47 +128,152 @@ auto CPU::tick() -> u8
     if(opcode == CB_OPCODE)
     {
         opcode = m_Gameboy.read(m_Registers.PC()++);
-        instruction = instructionsCB[opcode];
+        PROFILE_OPCODE_CB(opcode);
+        handler = handlersCB[opcode];
+        instruction = &instructionsCB[opcode];
         cycles += 4; // Add 4 cycles due to the CB prefix
 
-        ASSERT(instruction.op, "Opcode CB 0x" << std::setw(2) << std::setfill('0') << std::hex << static_cast<u16>(opcode) << ": " << instruction.mnemonic);
+        ASSERT(handler, "Opcode CB 0x" << std::setw(2) << std::setfill('0') << std::hex << static_cast<u16>(opcode) << ": " << instruction->mnemonic);
     }
     else
     {
-        instruction = instructions[opcode];
-        ASSERT(instruction.op, "Opcode 0x" << std::setw(2) << std::setfill('0') << std::hex << static_cast<u16>(opcode) << ": " << instruction.mnemonic);
+        handler = handlers[opcode];
+        instruction = &instructions[opcode];
+        ASSERT(handler, "Opcode 0x" << std::setw(2) << std::setfill('0') << std::hex << static_cast<u16>(opcode) << ": " << instruction->mnemonic);
+
+        fetchImmediate(instruction->length);
     }
 
     LOG_OP();
-    std::invoke(instruction.op);
+    handler(*this);
 
     if(m_Branched)
     {
         m_Branched = false;
-        cycles += instruction.cyclesBranch;
+        cycles += instruction->cyclesBranch;
     }
     else
     {
-        cycles += instruction.cyclesNoBranch;
+        cycles += instruction->cyclesNoBranch;
     }
 
     return cycles;
 }
 
+auto CPU::run(u64 cycleBudget) -> u64
+{
+    u64 spent = 0;
+
+    // Cycles are counted in 32 bits within the loops, so huge budgets are run in pieces
+    while(spent < cycleBudget)
+    {
+        auto budget = static_cast<u32>(std::min<u64>(cycleBudget - spent, UINT32_MAX));
+
+        switch(m_Interpreter)
+        {
+            #ifdef THREADED_INTERPRETER
+            case Interpreter::Threaded:
+                spent += runThreaded(budget);
+                break;
+            #endif
+            case Interpreter::Cached:
+            case Interpreter::JIT:
+                spent += runLoop<true>(budget);
+                break;
+            default:
+                spent += runLoop<false>(budget);
+        }
+    }
+
+    return spent;
+}
+
+template <bool Cached>
+auto CPU::runLoop(u32 budget) -> u32
+{
+    u32 spent = 0;
+
+    do
+    {
+        u16 start = m_Registers.PC();
+        u8 cycles = Cached ? tickCached() : tick();
+
+        handleInterrupts(cycles);
+        m_Gameboy.updateComponents(cycles);
+        spent += cycles;
+
+        if(m_Halted)
+        {
+            spent += m_Gameboy.skipHalt(spent, budget);
+        }
+        else if(m_Registers.PC() <= start) // Only a jump backwards can close a loop
+        {
+            spent += m_Gameboy.runMemoryLoop(spent, budget);
+            spent += m_Gameboy.skipIdleLoop(spent, budget);
+        }
+
+        PROFILE_SAMPLE(start);
+    } while(spent < budget);
+
+    return spent;
+}
+
+void CPU::setInterpreter(Interpreter interpreter)
+{
+    m_Interpreter = interpreter;
+}
+
+#ifdef GUEST_PROFILER
+void CPU::enableProfiler(const std::string& path, u32 interval)
+{
+    m_Profiler = std::make_unique<Profiler>(m_Gameboy, path, interval);
+}
+#endif
+
 void CPU::raiseInterrupt(const Flags::Interrupt& flag)
 {
     m_Halted = false;
 
-    m_Gameboy.write(IF_REGISTER, m_Gameboy.read(IF_REGISTER) | flag);
+    m_Gameboy.requestInterrupt(flag);
+}
+
+auto CPU::tickCached() -> u8
+{
+    if(m_Halted || m_HaltBug) return tick();
+
+    u8 cycles = m_BlockCache->run(m_Registers.PC());
+    return cycles ? cycles : tick();
+}
+
+auto CPU::enableBlockCache(bool jit) -> bool
+{
+    if(!m_BlockCache)
+    {
+        m_BlockCache = std::make_unique<BlockCache>(*this, m_Gameboy);
+    }
+
+    return m_BlockCache->setJIT(jit);
+}
+
+void CPU::invalidateCode(u16 address)
+{
+    m_BlockInvalidated = true;
+    if(m_BlockCache) m_BlockCache->invalidate(address);
+}
+
+void CPU::switchedBank()
+{
+    m_BlockInvalidated = true;
 }
 
 void CPU::handleInterrupts(u8& cycles)
 {
-    u8 flags = m_Gameboy.read(IF_REGISTER);
-    u8 enabledFlags = flags & m_Gameboy.read(IE_REGISTER) & 0x1F;
+    u8 enabledFlags = m_Gameboy.getPendingInterrupts();
 
     if(enabledFlags)
     {
+        u8 flags = m_Gameboy.getIF();
+
         if(m_IME)
         {
             if(enabledFlags & Flags::Interrupt::VBlank)
@@ -161,9 +306,11 @@ void CPU::handleInterrupts(u8& cycles)
                 pushStack(m_Registers.PC());
                 m_Registers.PC() = JOYPAD_VECTOR;
             }
+
+            PROFILE_CALL();
             
             m_IME = false;
-            m_Gameboy.write(IF_REGISTER, flags);
+            m_Gameboy.setIF(flags);
             
             // TODO: Have more accurate cycle updating
             cycles += 20; //NOLINT(cppcoreguidelines-avoid-magic-numbers)
@@ -177,35 +324,175 @@ void CPU::handleInterrupts(u8& cycles)
     }
 }
 
-auto CPU::isFlagSet(const Flags::Register& flag) const -> bool
+auto CPU::checkIdleLoop(u32 now) -> u32
 {
-    return m_Registers.F() & flag;
+    materializeFlags();
+
+    IdleState state { m_Registers.AF(), m_Registers.BC(), m_Registers.DE(), m_Registers.HL(),
+                      m_Registers.SP(), m_Registers.PC(), m_IME, m_Halted, m_HaltBug, m_Writes };
+
+    bool idle = m_IdleValid && state == m_IdleState && now > m_IdleCycles;
+    u32 period = now - m_IdleCycles;
+
+    m_IdleState  = state;
+    m_IdleCycles = now;
+    m_IdleValid  = true;
+
+    return idle ? period : 0;
 }
 
-void CPU::setFlag(const Flags::Register& flag)
+void CPU::skipIdleLoop(u32 cycles)
 {
-    m_Registers.F() |= flag;
+    m_IdleCycles += cycles;
 }
 
-void CPU::clearFlag(const Flags::Register& flag)
+void CPU::resetIdleLoop()
 {
-    m_Registers.F() &= ~flag;
+    m_IdleValid = false;
 }
 
-void CPU::flipFlag(const Flags::Register& flag)
+/**
+ * A copy or fill loop, as the code from its head up to and including the
+ * JR NZ back to it. Each iteration copies or fills one byte at HL (and DE)
+ * and counts down B, C or BC
+**/
+struct CPU::MemoryLoop
 {
-    m_Registers.F() ^= flag;
-}
+    enum class Counter : u8
+    {
+        B, C, BC
+    };
+
+    std::array<u8, 8> code; //NOLINT(cppcoreguidelines-avoid-magic-numbers)
+    u8 length;
+    Counter counter;
+    bool copy;          // Copies from (HL) to (DE) instead of filling (HL) with A
+    bool clear;         // Fills with 0, clearing A at the start of every iteration
+    bool decrement;     // HL counts down instead of up
 
-void CPU::clearAllFlags()
+    static const std::array<MemoryLoop, 8> loops; //NOLINT(cppcoreguidelines-avoid-magic-numbers)
+};
+
+const std::array<CPU::MemoryLoop, 8> CPU::MemoryLoop::loops //NOLINT(cppcoreguidelines-avoid-magic-numbers)
+{{
+    // LD A,(HL+); LD (DE),A; INC DE; DEC BC; LD A,B; OR C; JR NZ
+    { { 0x2A, 0x12, 0x13, 0x0B, 0x78, 0xB1, 0x20, 0xF8 }, 8, Counter::BC, true,  false, false },
+    // LD A,(HL+); LD (DE),A; INC DE; DEC B/C; JR NZ
+    { { 0x2A, 0x12, 0x13, 0x05, 0x20, 0xFA },             6, Counter::B,  true,  false, false },
+    { { 0x2A, 0x12, 0x13, 0x0D, 0x20, 0xFA },             6, Counter::C,  true,  false, false },
+    // XOR A; LD (HL+),A; DEC BC; LD A,B; OR C; JR NZ
+    { { 0xAF, 0x22, 0x0B, 0x78, 0xB1, 0x20, 0xF9 },       7, Counter::BC, false, true,  false },
+    // LD (HL+/-),A; DEC B/C; JR NZ
+    { { 0x22, 0x05, 0x20, 0xFC },                         4, Counter::B,  false, false, false },
+    { { 0x22, 0x0D, 0x20, 0xFC },                         4, Counter::C,  false, false, false },
+    { { 0x32, 0x05, 0x20, 0xFC },                         4, Counter::B,  false, false, true  },
+    { { 0x32, 0x0D, 0x20, 0xFC },                         4, Counter::C,  false, false, true  }
+}};
+
+auto CPU::checkMemoryLoop() -> u32
 {
-    clearFlag(Flags::Register::Zero      |
-              Flags::Register::Negative  |
-              Flags::Register::HalfCarry |
-              Flags::Register::Carry);
+    m_MemoryLoop = nullptr;
+
+    u16 pc = m_Registers.PC();
+    if(m_HaltBug || pc >= ECHO_RAM_START_ADDR - sizeof(MemoryLoop::code)) return 0;
+
+    // Most loops are told apart by their first opcode, so only read the rest for candidates
+    u8 first = m_Gameboy.read(pc);
+
+    for(const MemoryLoop& loop : MemoryLoop::loops)
+    {
+        if(loop.code[0] != first) continue;
+
+        bool match = true;
+        for(u8 i = 1; i < loop.length && match; ++i)
+        {
+            match = m_Gameboy.read(pc + i) == loop.code[i];
+        }
+
+        if(!match) continue;
+
+        // The loop only ends in a taken JR NZ while it keeps going
+        u32 cycles = 0;
+        for(u8 i = 0; i < loop.length; i += instructions[loop.code[i]].length)
+        {
+            const Instruction& instruction = instructions[loop.code[i]];
+            cycles += (i + instruction.length < loop.length) ? instruction.cyclesNoBranch : instruction.cyclesBranch;
+        }
+
+        m_MemoryLoop = &loop;
+        return cycles;
+    }
+
+    return 0;
 }
 
-void CPU::setZeroFromVal(u8 val)
+auto CPU::runMemoryLoop(u32 iterations) -> u32
 {
-    if(!val) setFlag(Flags::Register::Zero);
+    if(!m_MemoryLoop) return 0;
+
+    const MemoryLoop& loop = *m_MemoryLoop;
+    m_MemoryLoop = nullptr;
+
+    u32 count = 0;
+    switch(loop.counter)
+    {
+        case MemoryLoop::Counter::B:
+            count = m_Registers.B() ? m_Registers.B() : UINT8_MAX + 1;
+            break;
+        case MemoryLoop::Counter::C:
+            count = m_Registers.C() ? m_Registers.C() : UINT8_MAX + 1;
+            break;
+        case MemoryLoop::Counter::BC:
+            count = m_Registers.BC() ? m_Registers.BC() : UINT16_MAX + 1;
+            break;
+    }
+
+    // The last iteration leaves the loop, which the cpu has to run itself
+    auto done = static_cast<u16>(std::min(iterations, count - 1));
+    if(!done) return 0;
+
+    u16 hl    = m_Registers.HL();
+    u32 start = loop.decrement ? hl - (done - 1) : hl;
+    u32 dst   = loop.copy ? m_Registers.DE() : start;
+    u32 pc    = m_Registers.PC();
+
+    // Writing over the loop itself would change what the next iteration runs
+    if(loop.decrement && hl < done - 1) return 0;
+    if(dst < pc + loop.length && pc < dst + done) return 0;
+
+    if(loop.copy)
+    {
+        if(!m_Gameboy.copy(m_Registers.DE(), hl, done)) return 0;
+
+        m_Registers.A()   = m_Gameboy.read(hl + done - 1);
+        m_Registers.DE() += done;
+    }
+    else
+    {
+        if(loop.clear) m_Registers.A() = 0;
+        if(!m_Gameboy.fill(start, m_Registers.A(), done)) return 0;
+    }
+
+    m_Registers.HL() = loop.decrement ? hl - done : hl + done;
+    m_Writes += done;
+
+    // Count down to one above where the loop would be, so the last DEC or OR C leaves the same flags
+    switch(loop.counter)
+    {
+        case MemoryLoop::Counter::B:
+            m_Registers.B() -= done - 1;
+            opcodeDEC(m_Registers.B());
+            break;
+        case MemoryLoop::Counter::C:
+            m_Registers.C() -= done - 1;
+            opcodeDEC(m_Registers.C());
+            break;
+        case MemoryLoop::Counter::BC:
+            m_Registers.BC() -= done;
+            m_Registers.A() = m_Registers.B();
+            opcodeOR(m_Registers.C());
+            break;
+    }
+
+    return done;
 }
@@ -0,0 +1,168 @@
+#pragma once
+
+#include "core.hpp"
+
+#include "cpu.hpp"
+
+#include "gameboy.hpp"
+
+#include "logging/opcode_log.hpp"
+
+/**
+ * The opcode families. Most opcodes only differ in the operand they work
+ * on and the operation they run, both of which are encoded in the opcode
+ * itself, so they are generated from the templates here instead of being
+ * written out one by one.
+**/
+
+template <u8 Opcode>
+constexpr bool NO_FAMILY = false;
+
+template <CPU::Operand Reg>
+__always_inline auto CPU::getRegister() -> u8&
+{
+    if constexpr (Reg == Operand::B) return m_Registers.B();
+    else if constexpr (Reg == Operand::C) return m_Registers.C();
+    else if constexpr (Reg == Operand::D) return m_Registers.D();
+    else if constexpr (Reg == Operand::E) return m_Registers.E();
+    else if constexpr (Reg == Operand::H) return m_Registers.H();
+    else if constexpr (Reg == Operand::L) return m_Registers.L();
+    else if constexpr (Reg == Operand::A) return m_Registers.A();
+    else static_assert(Reg == Operand::A, "Operand is not a register");
+}
+
+template <CPU::Operand Src>
+__always_inline auto CPU::getOperand() -> u8
+{
+    if constexpr (Src == Operand::HL) return m_Gameboy.read(m_Registers.HL());
+    else if constexpr (Src == Operand::Immediate) return getImmediate8();
+    else return getRegister<Src>();
+}
+
+template <CPU::Operand Dst>
+__always_inline void CPU::setOperand(u8 val)
+{
+    static_assert(Dst != Operand::Immediate, "Can't write to an immediate");
+
+    if constexpr (Dst == Operand::HL) write(m_Registers.HL(), val);
+    else getRegister<Dst>() = val;
+}
+
+template <CPU::Operand Dst>
+__always_inline void CPU::logOperand()
+{
+    if constexpr (Dst == Operand::B) LOG_B_REG();
+    else if constexpr (Dst == Operand::C) LOG_C_REG();
+    else if constexpr (Dst == Operand::D) LOG_D_REG();
+    else if constexpr (Dst == Operand::E) LOG_E_REG();
+    else if constexpr (Dst == Operand::H) LOG_H_REG();
+    else if constexpr (Dst == Operand::L) LOG_L_REG();
+    else if constexpr (Dst == Operand::HL) LOG_WRITE(m_Registers.HL());
+    else if constexpr (Dst == Operand::A) LOG_A_REG();
+}
+
+template <CPU::Operand Dst, CPU::Operand Src>
+__always_inline void CPU::opcodeLD()
+{
+    setOperand<Dst>(getOperand<Src>());
+
+    logOperand<Dst>();
+}
+
+template <CPU::AluOp Op, CPU::Operand Src>
+__always_inline void CPU::opcodeALU()
+{
+    u8 val = getOperand<Src>();
+
+    if constexpr (Op == AluOp::ADD) opcodeADD(val);
+    else if constexpr (Op == AluOp::ADC) opcodeADC(val);
+    else if constexpr (Op == AluOp::SUB) opcodeSUB(val);
+    else if constexpr (Op == AluOp::SBC) opcodeSBC(val);
+    else if constexpr (Op == AluOp::AND) opcodeAND(val);
+    else if constexpr (Op == AluOp::XOR) opcodeXOR(val);
+    else if constexpr (Op == AluOp::OR)  opcodeOR(val);
+    else if constexpr (Op == AluOp::CP)  opcodeCP(val);
+}
+
+template <u8 Opcode>
+void CPU::opcode()
+{
+    // Bits 3-5 hold the destination or the ALU operation, bits 0-2 the source
+    constexpr auto dst = static_cast<Operand>((Opcode >> 3) & 0x07);
+    constexpr auto src = static_cast<Operand>(Opcode & 0x07);
+    constexpr auto op  = static_cast<AluOp>((Opcode >> 3) & 0x07);
+
+    if constexpr (0x40 <= Opcode && Opcode < 0x80)      // LD r,r'
+    {
+        opcodeLD<dst, src>();
+    }
+    else if constexpr (0x80 <= Opcode && Opcode < 0xC0) // ALU A,r
+    {
+        opcodeALU<op, src>();
+    }
+    else if constexpr ((Opcode & 0xC7) == 0xC6)         // ALU A,u8
+    {
+        opcodeALU<op, Operand::Immediate>();
+    }
+    else if constexpr ((Opcode & 0xC7) == 0x06)         // LD r,u8
+    {
+        opcodeLD<dst, Operand::Immediate>();
+    }
+    else if constexpr ((Opcode & 0xC6) == 0x04)         // INC r, DEC r
+    {
+        u8 val = getOperand<dst>();
+
+        if constexpr (Opcode & 0x01) opcodeDEC(val);
+        else opcodeINC(val);
+
+        setOperand<dst>(val);
+
+        logOperand<dst>();
+    }
+    else
+    {
+        static_assert(NO_FAMILY<Opcode>, "Opcode doesn't belong to a family and needs its own specialization");
+    }
+}
+
+template <u8 Opcode>
+void CPU::opcodeCB()
+{
+    // Bits 3-5 hold the shift or the bit to work on, bits 0-2 the operand
+    constexpr auto reg = static_cast<Operand>(Opcode & 0x07);
+    constexpr u8   row = (Opcode >> 3) & 0x07;
+
+    if constexpr (Opcode < 0x40)        // RLC, RRC, RL, RR, SLA, SRA, SWAP, SRL
+    {
+        constexpr std::array<void (CPU::*)(u8&), 8> shifts
+        {
+            &CPU::opcodeRLC, &CPU::opcodeRRC, &CPU::opcodeRL,   &CPU::opcodeRR,
+            &CPU::opcodeSLA, &CPU::opcodeSRA, &CPU::opcodeSWAP, &CPU::opcodeSRL
+        };
+
+        u8 val = getOperand<reg>();
+        (this->*shifts[row])(val);
+        setOperand<reg>(val);
+
+        logOperand<reg>();
+        LOG_FLAGS();
+    }
+    else if constexpr (Opcode < 0x80)   // BIT
+    {
+        opcodeBIT(row, getOperand<reg>());
+
+        LOG_FLAGS();
+    }
+    else if constexpr (Opcode < 0xC0)   // RES
+    {
+        setOperand<reg>(getOperand<reg>() & ~(0x01 << row));
+
+        logOperand<reg>();
+    }
+    else                                // SET
+    {
+        setOperand<reg>(getOperand<reg>() | (0x01 << row));
+
+        logOperand<reg>();
+    }
+}
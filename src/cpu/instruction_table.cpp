@@ -0,0 +1,634 @@
+#include "core.hpp"
+
+#include "instruction.hpp"
+#include "cpu.hpp"
+
+#include "instruction_families.hpp"
+
+//--------------------------------------Opcode Handlers--------------------------------------//
+
+/**
+ * @brief Checks if an opcode has a handler
+ * 
+ * @param opcode The opcode to check
+ * @return False for the unused opcodes and the CB prefix, which is decoded by the caller
+ */
+static constexpr auto hasHandler(std::size_t opcode) -> bool
+{
+    switch(opcode)
+    {
+        case CB_OPCODE:
+        case 0xD3: case 0xDB: case 0xDD: //NOLINT(cppcoreguidelines-avoid-magic-numbers)
+        case 0xE3: case 0xE4: case 0xEB: case 0xEC: case 0xED: //NOLINT(cppcoreguidelines-avoid-magic-numbers)
+        case 0xF4: case 0xFC: case 0xFD: //NOLINT(cppcoreguidelines-avoid-magic-numbers)
+            return false;
+        default:
+            return true;
+    }
+}
+
+template <std::size_t Opcode>
+constexpr auto CPU::getHandler() -> Handler
+{
+    if constexpr (hasHandler(Opcode)) return &CPU::dispatch<Opcode>;
+    else return nullptr;
+}
+
+template <std::size_t... Opcodes>
+constexpr auto CPU::makeHandlers(std::index_sequence<Opcodes...>) -> std::array<Handler, 0x100>
+{
+    return {{ getHandler<Opcodes>()... }};
+}
+
+template <std::size_t... Opcodes>
+constexpr auto CPU::makeHandlersCB(std::index_sequence<Opcodes...>) -> std::array<Handler, 0x100>
+{
+    return {{ &CPU::dispatchCB<Opcodes>... }};
+}
+
+constexpr std::array<CPU::Handler, 0x100> CPU::handlers   = makeHandlers(std::make_index_sequence<0x100>());
+constexpr std::array<CPU::Handler, 0x100> CPU::handlersCB = makeHandlersCB(std::make_index_sequence<0x100>());
+
+//--------------------------------------Opcode Metadata--------------------------------------//
+
+constexpr std::array<Instruction, 0x100> CPU::instructions
+{{
+    //0x00
+    INSTRUCTION("NOP",              1,  4,  4),
+    INSTRUCTION("LD BC,u16",        3, 12, 12),
+    INSTRUCTION("LD (BC),A",        1,  8,  8),
+    INSTRUCTION("INC BC",           1,  8,  8),
+    INSTRUCTION("INC B",            1,  4,  4),
+    INSTRUCTION("DEC B",            1,  4,  4),
+    INSTRUCTION("LD B,u8",          2,  8,  8),
+    INSTRUCTION("RLCA",             1,  4,  4),
+    INSTRUCTION("LD (u16),SP",      3, 20, 20),
+    INSTRUCTION("ADD HL,BC",        1,  8,  8),
+    INSTRUCTION("LD A,(BC)",        1,  8,  8),
+    INSTRUCTION("DEC BC",           1,  8,  8),
+    INSTRUCTION("INC C",            1,  4,  4),
+    INSTRUCTION("DEC C",            1,  4,  4),
+    INSTRUCTION("LD C,u8",          2,  8,  8),
+    INSTRUCTION("RRCA",             1,  4,  4),
+
+    //0x10
+    INSTRUCTION("STOP",             2,  4,  4),
+    INSTRUCTION("LD DE,u16",        3, 12, 12),
+    INSTRUCTION("LD (DE),A",        1,  8,  8),
+    INSTRUCTION("INC DE",           1,  8,  8),
+    INSTRUCTION("INC D",            1,  4,  4),
+    INSTRUCTION("DEC D",            1,  4,  4),
+    INSTRUCTION("LD D,u8",          2,  8,  8),
+    INSTRUCTION("RLA",              1,  4,  4),
+    INSTRUCTION("JR i8",            2, 12, 12),
+    INSTRUCTION("ADD HL,DE",        1,  8,  8),
+    INSTRUCTION("LD A,(DE)",        1,  8,  8),
+    INSTRUCTION("DEC DE",           1,  8,  8),
+    INSTRUCTION("INC E",            1,  4,  4),
+    INSTRUCTION("DEC E",            1,  4,  4),
+    INSTRUCTION("LD E,u8",          2,  8,  8),
+    INSTRUCTION("RRA",              1,  4,  4),
+
+    //0x20
+    INSTRUCTION("JR NZ,i8",         2, 12,  8),
+    INSTRUCTION("LD HL,u16",        3, 12, 12),
+    INSTRUCTION("LD (HL+),A",       1,  8,  8),
+    INSTRUCTION("INC HL",           1,  8,  8),
+    INSTRUCTION("INC H",            1,  4,  4),
+    INSTRUCTION("DEC H",            1,  4,  4),
+    INSTRUCTION("LD H,u8",          2,  8,  8),
+    INSTRUCTION("DAA",              1,  4,  4),
+    INSTRUCTION("JR Z,i8",          2, 12,  8),
+    INSTRUCTION("ADD HL,HL",        1,  8,  8),
+    INSTRUCTION("LD A,(HL+)",       1,  8,  8),
+    INSTRUCTION("DEC HL",           1,  8,  8),
+    INSTRUCTION("INC L",            1,  4,  4),
+    INSTRUCTION("DEC L",            1,  4,  4),
+    INSTRUCTION("LD L,u8",          2,  8,  8),
+    INSTRUCTION("CPL",              1,  4,  4),
+
+    //0x30
+    INSTRUCTION("JR NC,i8",         2, 12,  8),
+    INSTRUCTION("LD SP,u16",        3, 12, 12),
+    INSTRUCTION("LD (HL-),A",       1,  8,  8),
+    INSTRUCTION("INC SP",           1,  8,  8),
+    INSTRUCTION("INC (HL)",         1, 12, 12),
+    INSTRUCTION("DEC (HL)",         1, 12, 12),
+    INSTRUCTION("LD (HL),u8",       2, 12, 12),
+    INSTRUCTION("SCF",              1,  4,  4),
+    INSTRUCTION("JR C,i8",          2, 12,  8),
+    INSTRUCTION("ADD HL,SP",        1,  8,  8),
+    INSTRUCTION("LD A,(HL-)",       1,  8,  8),
+    INSTRUCTION("DEC SP",           1,  8,  8),
+    INSTRUCTION("INC A",            1,  4,  4),
+    INSTRUCTION("DEC A",            1,  4,  4),
+    INSTRUCTION("LD A,u8",          2,  8,  8),
+    INSTRUCTION("CCF",              1,  4,  4),
+
+    //0x40
+    INSTRUCTION("LD B,B",           1,  4,  4),
+    INSTRUCTION("LD B,C",           1,  4,  4),
+    INSTRUCTION("LD B,D",           1,  4,  4),
+    INSTRUCTION("LD B,E",           1,  4,  4),
+    INSTRUCTION("LD B,H",           1,  4,  4),
+    INSTRUCTION("LD B,L",           1,  4,  4),
+    INSTRUCTION("LD B,(HL)",        1,  8,  8),
+    INSTRUCTION("LD B,A",           1,  4,  4),
+    INSTRUCTION("LD C,B",           1,  4,  4),
+    INSTRUCTION("LD C,C",           1,  4,  4),
+    INSTRUCTION("LD C,D",           1,  4,  4),
+    INSTRUCTION("LD C,E",           1,  4,  4),
+    INSTRUCTION("LD C,H",           1,  4,  4),
+    INSTRUCTION("LD C,L",           1,  4,  4),
+    INSTRUCTION("LD C,(HL)",        1,  8,  8),
+    INSTRUCTION("LD C,A",           1,  4,  4),
+
+    //0x50
+    INSTRUCTION("LD D,B",           1,  4,  4),
+    INSTRUCTION("LD D,C",           1,  4,  4),
+    INSTRUCTION("LD D,D",           1,  4,  4),
+    INSTRUCTION("LD D,E",           1,  4,  4),
+    INSTRUCTION("LD D,H",           1,  4,  4),
+    INSTRUCTION("LD D,L",           1,  4,  4),
+    INSTRUCTION("LD D,(HL)",        1,  8,  8),
+    INSTRUCTION("LD D,A",           1,  4,  4),
+    INSTRUCTION("LD E,B",           1,  4,  4),
+    INSTRUCTION("LD E,C",           1,  4,  4),
+    INSTRUCTION("LD E,D",           1,  4,  4),
+    INSTRUCTION("LD E,E",           1,  4,  4),
+    INSTRUCTION("LD E,H",           1,  4,  4),
+    INSTRUCTION("LD E,L",           1,  4,  4),
+    INSTRUCTION("LD E,(HL)",        1,  8,  8),
+    INSTRUCTION("LD E,A",           1,  4,  4),
+
+    //0x60
+    INSTRUCTION("LD H,B",           1,  4,  4),
+    INSTRUCTION("LD H,C",           1,  4,  4),
+    INSTRUCTION("LD H,D",           1,  4,  4),
+    INSTRUCTION("LD H,E",           1,  4,  4),
+    INSTRUCTION("LD H,H",           1,  4,  4),
+    INSTRUCTION("LD H,L",           1,  4,  4),
+    INSTRUCTION("LD H,(HL)",        1,  8,  8),
+    INSTRUCTION("LD H,A",           1,  4,  4),
+    INSTRUCTION("LD L,B",           1,  4,  4),
+    INSTRUCTION("LD L,C",           1,  4,  4),
+    INSTRUCTION("LD L,D",           1,  4,  4),
+    INSTRUCTION("LD L,E",           1,  4,  4),
+    INSTRUCTION("LD L,H",           1,  4,  4),
+    INSTRUCTION("LD L,L",           1,  4,  4),
+    INSTRUCTION("LD L,(HL)",        1,  8,  8),
+    INSTRUCTION("LD L,A",           1,  4,  4),
+
+    //0x70
+    INSTRUCTION("LD (HL),B",        1,  8,  8),
+    INSTRUCTION("LD (HL),C",        1,  8,  8),
+    INSTRUCTION("LD (HL),D",        1,  8,  8),
+    INSTRUCTION("LD (HL),E",        1,  8,  8),
+    INSTRUCTION("LD (HL),H",        1,  8,  8),
+    INSTRUCTION("LD (HL),L",        1,  8,  8),
+    INSTRUCTION("HALT",             1,  4,  4),
+    INSTRUCTION("LD (HL),A",        1,  8,  8),
+    INSTRUCTION("LD A,B",           1,  4,  4),
+    INSTRUCTION("LD A,C",           1,  4,  4),
+    INSTRUCTION("LD A,D",           1,  4,  4),
+    INSTRUCTION("LD A,E",           1,  4,  4),
+    INSTRUCTION("LD A,H",           1,  4,  4),
+    INSTRUCTION("LD A,L",           1,  4,  4),
+    INSTRUCTION("LD A,(HL)",        1,  8,  8),
+    INSTRUCTION("LD A,A",           1,  4,  4),
+
+    //0x80
+    INSTRUCTION("ADD A,B",          1,  4,  4),
+    INSTRUCTION("ADD A,C",          1,  4,  4),
+    INSTRUCTION("ADD A,D",          1,  4,  4),
+    INSTRUCTION("ADD A,E",          1,  4,  4),
+    INSTRUCTION("ADD A,H",          1,  4,  4),
+    INSTRUCTION("ADD A,L",          1,  4,  4),
+    INSTRUCTION("ADD A,(HL)",       1,  8,  8),
+    INSTRUCTION("ADD A,A",          1,  4,  4),
+    INSTRUCTION("ADC A,B",          1,  4,  4),
+    INSTRUCTION("ADC A,C",          1,  4,  4),
+    INSTRUCTION("ADC A,D",          1,  4,  4),
+    INSTRUCTION("ADC A,E",          1,  4,  4),
+    INSTRUCTION("ADC A,H",          1,  4,  4),
+    INSTRUCTION("ADC A,L",          1,  4,  4),
+    INSTRUCTION("ADC A,(HL)",       1,  8,  8),
+    INSTRUCTION("ADC A,A",          1,  4,  4),
+
+    //0x90
+    INSTRUCTION("SUB A,B",          1,  4,  4),
+    INSTRUCTION("SUB A,C",          1,  4,  4),
+    INSTRUCTION("SUB A,D",          1,  4,  4),
+    INSTRUCTION("SUB A,E",          1,  4,  4),
+    INSTRUCTION("SUB A,H",          1,  4,  4),
+    INSTRUCTION("SUB A,L",          1,  4,  4),
+    INSTRUCTION("SUB A,(HL)",       1,  8,  8),
+    INSTRUCTION("SUB A,A",          1,  4,  4),
+    INSTRUCTION("SBC A,B",          1,  4,  4),
+    INSTRUCTION("SBC A,C",          1,  4,  4),
+    INSTRUCTION("SBC A,D",          1,  4,  4),
+    INSTRUCTION("SBC A,E",          1,  4,  4),
+    INSTRUCTION("SBC A,H",          1,  4,  4),
+    INSTRUCTION("SBC A,L",          1,  4,  4),
+    INSTRUCTION("SBC A,(HL)",       1,  8,  8),
+    INSTRUCTION("SBC A,A",          1,  4,  4),
+
+    //0xA0
+    INSTRUCTION("AND A,B",          1,  4,  4),
+    INSTRUCTION("AND A,C",          1,  4,  4),
+    INSTRUCTION("AND A,D",          1,  4,  4),
+    INSTRUCTION("AND A,E",          1,  4,  4),
+    INSTRUCTION("AND A,H",          1,  4,  4),
+    INSTRUCTION("AND A,L",          1,  4,  4),
+    INSTRUCTION("AND A,(HL)",       1,  8,  8),
+    INSTRUCTION("AND A,A",          1,  4,  4),
+    INSTRUCTION("XOR A,B",          1,  4,  4),
+    INSTRUCTION("XOR A,C",          1,  4,  4),
+    INSTRUCTION("XOR A,D",          1,  4,  4),
+    INSTRUCTION("XOR A,E",          1,  4,  4),
+    INSTRUCTION("XOR A,H",          1,  4,  4),
+    INSTRUCTION("XOR A,L",          1,  4,  4),
+    INSTRUCTION("XOR A,(HL)",       1,  8,  8),
+    INSTRUCTION("XOR A,A",          1,  4,  4),
+
+    //0xB0
+    INSTRUCTION("OR A,B",           1,  4,  4),
+    INSTRUCTION("OR A,C",           1,  4,  4),
+    INSTRUCTION("OR A,D",           1,  4,  4),
+    INSTRUCTION("OR A,E",           1,  4,  4),
+    INSTRUCTION("OR A,H",           1,  4,  4),
+    INSTRUCTION("OR A,L",           1,  4,  4),
+    INSTRUCTION("OR A,(HL)",        1,  8,  8),
+    INSTRUCTION("OR A,A",           1,  4,  4),
+    INSTRUCTION("CP A,B",           1,  4,  4),
+    INSTRUCTION("CP A,C",           1,  4,  4),
+    INSTRUCTION("CP A,D",           1,  4,  4),
+    INSTRUCTION("CP A,E",           1,  4,  4),
+    INSTRUCTION("CP A,H",           1,  4,  4),
+    INSTRUCTION("CP A,L",           1,  4,  4),
+    INSTRUCTION("CP A,(HL)",        1,  8,  8),
+    INSTRUCTION("CP A,A",           1,  4,  4),
+
+    //0xC0
+    INSTRUCTION("RET NZ",           1, 20,  8),
+    INSTRUCTION("POP BC",           1, 12, 12),
+    INSTRUCTION("JP NZ,u16",        3, 16, 12),
+    INSTRUCTION("JP u16",           3, 16, 16),
+    INSTRUCTION("CALL NZ,u16",      3, 24, 12),
+    INSTRUCTION("PUSH BC",          1, 16, 16),
+    INSTRUCTION("ADD A,u8",         2,  8,  8),
+    INSTRUCTION("RST 00h",          1, 16, 16),
+    INSTRUCTION("RET Z",            1, 20,  8),
+    INSTRUCTION("RET",              1, 16, 16),
+    INSTRUCTION("JP Z,u16",         3, 16, 12),
+    INSTRUCTION("PREFIX CB",        1,  4,  4),
+    INSTRUCTION("CALL Z,u16",       3, 24, 12),
+    INSTRUCTION("CALL u16",         3, 24, 24),
+    INSTRUCTION("ADC A,u8",         2,  8,  8),
+    INSTRUCTION("RST 08h",          1, 16, 16),
+
+    //0xD0
+    INSTRUCTION("RET NC",           1, 20,  8),
+    INSTRUCTION("POP DE",           1, 12, 12),
+    INSTRUCTION("JP NC,u16",        3, 16, 12),
+    INSTRUCTION("UNUSED",           1,  0,  0),
+    INSTRUCTION("CALL NC,u16",      3, 24, 12),
+    INSTRUCTION("PUSH DE",          1, 16, 16),
+    INSTRUCTION("SUB A,u8",         2,  8,  8),
+    INSTRUCTION("RST 10h",          1, 16, 16),
+    INSTRUCTION("RET C",            1, 20,  8),
+    INSTRUCTION("RETI",             1, 16, 16),
+    INSTRUCTION("JP C,u16",         3, 16, 12),
+    INSTRUCTION("UNUSED",           1,  0,  0),
+    INSTRUCTION("CALL C,u16",       3, 24, 12),
+    INSTRUCTION("UNUSED",           1,  0,  0),
+    INSTRUCTION("SBC A,u8",         2,  8,  8),
+    INSTRUCTION("RST 18h",          1, 16, 16),
+
+    //0xE0
+    INSTRUCTION("LD (FF00+u8),A",   2, 12, 12),
+    INSTRUCTION("POP HL",           1, 12, 12),
+    INSTRUCTION("LD (FF00+C),A",    1,  8,  8),
+    INSTRUCTION("UNUSED",           1,  0,  0),
+    INSTRUCTION("UNUSED",           1,  0,  0),
+    INSTRUCTION("PUSH HL",          1, 16, 16),
+    INSTRUCTION("AND A,u8",         2,  8,  8),
+    INSTRUCTION("RST 20h",          1, 16, 16),
+    INSTRUCTION("ADD SP,i8",        2, 16, 16),
+    INSTRUCTION("JP HL",            1,  4,  4),
+    INSTRUCTION("LD (u16),A",       3, 16, 16),
+    INSTRUCTION("UNUSED",           1,  0,  0),
+    INSTRUCTION("UNUSED",           1,  0,  0),
+    INSTRUCTION("UNUSED",           1,  0,  0),
+    INSTRUCTION("XOR A,u8",         2,  8,  8),
+    INSTRUCTION("RST 28h",          1, 16, 16),
+
+    //0xF0
+    INSTRUCTION("LD A,(FF00+u8)",   2, 12, 12),
+    INSTRUCTION("POP AF",           1, 12, 12),
+    INSTRUCTION("LD A,(FF00+C)",    1,  8,  8),
+    INSTRUCTION("DI",               1,  4,  4),
+    INSTRUCTION("UNUSED",           1,  0,  0),
+    INSTRUCTION("PUSH AF",          1, 16, 16),
+    INSTRUCTION("OR A,u8",          2,  8,  8),
+    INSTRUCTION("RST 30h",          1, 16, 16),
+    INSTRUCTION("LD HL,SP+i8",      2, 12, 12),
+    INSTRUCTION("LD SP,HL",         1,  8,  8),
+    INSTRUCTION("LD A,(u16)",       3, 16, 16),
+    INSTRUCTION("EI",               1,  4,  4),
+    INSTRUCTION("UNUSED",           1,  0,  0),
+    INSTRUCTION("UNUSED",           1,  0,  0),
+    INSTRUCTION("CP A,u8",          2,  8,  8),
+    INSTRUCTION("RST 38h",          1, 16, 16)
+}};
+
+constexpr std::array<Instruction, 0x100> CPU::instructionsCB
+{{
+    //0x00
+    INSTRUCTION("RLC B",            2,  8,  8),
+    INSTRUCTION("RLC C",            2,  8,  8),
+    INSTRUCTION("RLC D",            2,  8,  8),
+    INSTRUCTION("RLC E",            2,  8,  8),
+    INSTRUCTION("RLC H",            2,  8,  8),
+    INSTRUCTION("RLC L",            2,  8,  8),
+    INSTRUCTION("RLC (HL)",         2, 16, 16),
+    INSTRUCTION("RLC A",            2,  8,  8),
+    INSTRUCTION("RRC B",            2,  8,  8),
+    INSTRUCTION("RRC C",            2,  8,  8),
+    INSTRUCTION("RRC D",            2,  8,  8),
+    INSTRUCTION("RRC E",            2,  8,  8),
+    INSTRUCTION("RRC H",            2,  8,  8),
+    INSTRUCTION("RRC L",            2,  8,  8),
+    INSTRUCTION("RRC (HL)",         2, 16, 16),
+    INSTRUCTION("RRC A",            2,  8,  8),
+
+    //0x10
+    INSTRUCTION("RL B",             2,  8,  8),
+    INSTRUCTION("RL C",             2,  8,  8),
+    INSTRUCTION("RL D",             2,  8,  8),
+    INSTRUCTION("RL E",             2,  8,  8),
+    INSTRUCTION("RL H",             2,  8,  8),
+    INSTRUCTION("RL L",             2,  8,  8),
+    INSTRUCTION("RL (HL)",          2, 16, 16),
+    INSTRUCTION("RL A",             2,  8,  8),
+    INSTRUCTION("RR B",             2,  8,  8),
+    INSTRUCTION("RR C",             2,  8,  8),
+    INSTRUCTION("RR D",             2,  8,  8),
+    INSTRUCTION("RR E",             2,  8,  8),
+    INSTRUCTION("RR H",             2,  8,  8),
+    INSTRUCTION("RR L",             2,  8,  8),
+    INSTRUCTION("RR (HL)",          2, 16, 16),
+    INSTRUCTION("RR A",             2,  8,  8),
+
+    //0x20
+    INSTRUCTION("SLA B",            2,  8,  8),
+    INSTRUCTION("SLA C",            2,  8,  8),
+    INSTRUCTION("SLA D",            2,  8,  8),
+    INSTRUCTION("SLA E",            2,  8,  8),
+    INSTRUCTION("SLA H",            2,  8,  8),
+    INSTRUCTION("SLA L",            2,  8,  8),
+    INSTRUCTION("SLA (HL)",         2, 16, 16),
+    INSTRUCTION("SLA A",            2,  8,  8),
+    INSTRUCTION("SRA B",            2,  8,  8),
+    INSTRUCTION("SRA C",            2,  8,  8),
+    INSTRUCTION("SRA D",            2,  8,  8),
+    INSTRUCTION("SRA E",            2,  8,  8),
+    INSTRUCTION("SRA H",            2,  8,  8),
+    INSTRUCTION("SRA L",            2,  8,  8),
+    INSTRUCTION("SRA (HL)",         2, 16, 16),
+    INSTRUCTION("SRA A",            2,  8,  8),
+
+    //0x30
+    INSTRUCTION("SWAP B",           2,  8,  8),
+    INSTRUCTION("SWAP C",           2,  8,  8),
+    INSTRUCTION("SWAP D",           2,  8,  8),
+    INSTRUCTION("SWAP E",           2,  8,  8),
+    INSTRUCTION("SWAP H",           2,  8,  8),
+    INSTRUCTION("SWAP L",           2,  8,  8),
+    INSTRUCTION("SWAP (HL)",        2, 16, 16),
+    INSTRUCTION("SWAP A",           2,  8,  8),
+    INSTRUCTION("SRL B",            2,  8,  8),
+    INSTRUCTION("SRL C",            2,  8,  8),
+    INSTRUCTION("SRL D",            2,  8,  8),
+    INSTRUCTION("SRL E",            2,  8,  8),
+    INSTRUCTION("SRL H",            2,  8,  8),
+    INSTRUCTION("SRL L",            2,  8,  8),
+    INSTRUCTION("SRL (HL)",         2, 16, 16),
+    INSTRUCTION("SRL A",            2,  8,  8),
+
+    //0x40
+    INSTRUCTION("BIT 0,B",          2,  8,  8),
+    INSTRUCTION("BIT 0,C",          2,  8,  8),
+    INSTRUCTION("BIT 0,D",          2,  8,  8),
+    INSTRUCTION("BIT 0,E",          2,  8,  8),
+    INSTRUCTION("BIT 0,H",          2,  8,  8),
+    INSTRUCTION("BIT 0,L",          2,  8,  8),
+    INSTRUCTION("BIT 0,(HL)",       2, 12, 12),
+    INSTRUCTION("BIT 0,A",          2,  8,  8),
+    INSTRUCTION("BIT 1,B",          2,  8,  8),
+    INSTRUCTION("BIT 1,C",          2,  8,  8),
+    INSTRUCTION("BIT 1,D",          2,  8,  8),
+    INSTRUCTION("BIT 1,E",          2,  8,  8),
+    INSTRUCTION("BIT 1,H",          2,  8,  8),
+    INSTRUCTION("BIT 1,L",          2,  8,  8),
+    INSTRUCTION("BIT 1,(HL)",       2, 12, 12),
+    INSTRUCTION("BIT 1,A",          2,  8,  8),
+
+    //0x50
+    INSTRUCTION("BIT 2,B",          2,  8,  8),
+    INSTRUCTION("BIT 2,C",          2,  8,  8),
+    INSTRUCTION("BIT 2,D",          2,  8,  8),
+    INSTRUCTION("BIT 2,E",          2,  8,  8),
+    INSTRUCTION("BIT 2,H",          2,  8,  8),
+    INSTRUCTION("BIT 2,L",          2,  8,  8),
+    INSTRUCTION("BIT 2,(HL)",       2, 12, 12),
+    INSTRUCTION("BIT 2,A",          2,  8,  8),
+    INSTRUCTION("BIT 3,B",          2,  8,  8),
+    INSTRUCTION("BIT 3,C",          2,  8,  8),
+    INSTRUCTION("BIT 3,D",          2,  8,  8),
+    INSTRUCTION("BIT 3,E",          2,  8,  8),
+    INSTRUCTION("BIT 3,H",          2,  8,  8),
+    INSTRUCTION("BIT 3,L",          2,  8,  8),
+    INSTRUCTION("BIT 3,(HL)",       2, 12, 12),
+    INSTRUCTION("BIT 3,A",          2,  8,  8),
+
+    //0x60
+    INSTRUCTION("BIT 4,B",          2,  8,  8),
+    INSTRUCTION("BIT 4,C",          2,  8,  8),
+    INSTRUCTION("BIT 4,D",          2,  8,  8),
+    INSTRUCTION("BIT 4,E",          2,  8,  8),
+    INSTRUCTION("BIT 4,H",          2,  8,  8),
+    INSTRUCTION("BIT 4,L",          2,  8,  8),
+    INSTRUCTION("BIT 4,(HL)",       2, 12, 12),
+    INSTRUCTION("BIT 4,A",          2,  8,  8),
+    INSTRUCTION("BIT 5,B",          2,  8,  8),
+    INSTRUCTION("BIT 5,C",          2,  8,  8),
+    INSTRUCTION("BIT 5,D",          2,  8,  8),
+    INSTRUCTION("BIT 5,E",          2,  8,  8),
+    INSTRUCTION("BIT 5,H",          2,  8,  8),
+    INSTRUCTION("BIT 5,L",          2,  8,  8),
+    INSTRUCTION("BIT 5,(HL)",       2, 12, 12),
+    INSTRUCTION("BIT 5,A",          2,  8,  8),
+
+    //0x70
+    INSTRUCTION("BIT 6,B",          2,  8,  8),
+    INSTRUCTION("BIT 6,C",          2,  8,  8),
+    INSTRUCTION("BIT 6,D",          2,  8,  8),
+    INSTRUCTION("BIT 6,E",          2,  8,  8),
+    INSTRUCTION("BIT 6,H",          2,  8,  8),
+    INSTRUCTION("BIT 6,L",          2,  8,  8),
+    INSTRUCTION("BIT 6,(HL)",       2, 12, 12),
+    INSTRUCTION("BIT 6,A",          2,  8,  8),
+    INSTRUCTION("BIT 7,B",          2,  8,  8),
+    INSTRUCTION("BIT 7,C",          2,  8,  8),
+    INSTRUCTION("BIT 7,D",          2,  8,  8),
+    INSTRUCTION("BIT 7,E",          2,  8,  8),
+    INSTRUCTION("BIT 7,H",          2,  8,  8),
+    INSTRUCTION("BIT 7,L",          2,  8,  8),
+    INSTRUCTION("BIT 7,(HL)",       2, 12, 12),
+    INSTRUCTION("BIT 7,A",          2,  8,  8),
+
+    //0x80
+    INSTRUCTION("RES 0,B",          2,  8,  8),
+    INSTRUCTION("RES 0,C",          2,  8,  8),
+    INSTRUCTION("RES 0,D",          2,  8,  8),
+    INSTRUCTION("RES 0,E",          2,  8,  8),
+    INSTRUCTION("RES 0,H",          2,  8,  8),
+    INSTRUCTION("RES 0,L",          2,  8,  8),
+    INSTRUCTION("RES 0,(HL)",       2, 16, 16),
+    INSTRUCTION("RES 0,A",          2,  8,  8),
+    INSTRUCTION("RES 1,B",          2,  8,  8),
+    INSTRUCTION("RES 1,C",          2,  8,  8),
+    INSTRUCTION("RES 1,D",          2,  8,  8),
+    INSTRUCTION("RES 1,E",          2,  8,  8),
+    INSTRUCTION("RES 1,H",          2,  8,  8),
+    INSTRUCTION("RES 1,L",          2,  8,  8),
+    INSTRUCTION("RES 1,(HL)",       2, 16, 16),
+    INSTRUCTION("RES 1,A",          2,  8,  8),
+
+    //0x90
+    INSTRUCTION("RES 2,B",          2,  8,  8),
+    INSTRUCTION("RES 2,C",          2,  8,  8),
+    INSTRUCTION("RES 2,D",          2,  8,  8),
+    INSTRUCTION("RES 2,E",          2,  8,  8),
+    INSTRUCTION("RES 2,H",          2,  8,  8),
+    INSTRUCTION("RES 2,L",          2,  8,  8),
+    INSTRUCTION("RES 2,(HL)",       2, 16, 16),
+    INSTRUCTION("RES 2,A",          2,  8,  8),
+    INSTRUCTION("RES 3,B",          2,  8,  8),
+    INSTRUCTION("RES 3,C",          2,  8,  8),
+    INSTRUCTION("RES 3,D",          2,  8,  8),
+    INSTRUCTION("RES 3,E",          2,  8,  8),
+    INSTRUCTION("RES 3,H",          2,  8,  8),
+    INSTRUCTION("RES 3,L",          2,  8,  8),
+    INSTRUCTION("RES 3,(HL)",       2, 16, 16),
+    INSTRUCTION("RES 3,A",          2,  8,  8),
+
+    //0xA0
+    INSTRUCTION("RES 4,B",          2,  8,  8),
+    INSTRUCTION("RES 4,C",          2,  8,  8),
+    INSTRUCTION("RES 4,D",          2,  8,  8),
+    INSTRUCTION("RES 4,E",          2,  8,  8),
+    INSTRUCTION("RES 4,H",          2,  8,  8),
+    INSTRUCTION("RES 4,L",          2,  8,  8),
+    INSTRUCTION("RES 4,(HL)",       2, 16, 16),
+    INSTRUCTION("RES 4,A",          2,  8,  8),
+    INSTRUCTION("RES 5,B",          2,  8,  8),
+    INSTRUCTION("RES 5,C",          2,  8,  8),
+    INSTRUCTION("RES 5,D",          2,  8,  8),
+    INSTRUCTION("RES 5,E",          2,  8,  8),
+    INSTRUCTION("RES 5,H",          2,  8,  8),
+    INSTRUCTION("RES 5,L",          2,  8,  8),
+    INSTRUCTION("RES 5,(HL)",       2, 16, 16),
+    INSTRUCTION("RES 5,A",          2,  8,  8),
+
+    //0xB0
+    INSTRUCTION("RES 6,B",          2,  8,  8),
+    INSTRUCTION("RES 6,C",          2,  8,  8),
+    INSTRUCTION("RES 6,D",          2,  8,  8),
+    INSTRUCTION("RES 6,E",          2,  8,  8),
+    INSTRUCTION("RES 6,H",          2,  8,  8),
+    INSTRUCTION("RES 6,L",          2,  8,  8),
+    INSTRUCTION("RES 6,(HL)",       2, 16, 16),
+    INSTRUCTION("RES 6,A",          2,  8,  8),
+    INSTRUCTION("RES 7,B",          2,  8,  8),
+    INSTRUCTION("RES 7,C",          2,  8,  8),
+    INSTRUCTION("RES 7,D",          2,  8,  8),
+    INSTRUCTION("RES 7,E",          2,  8,  8),
+    INSTRUCTION("RES 7,H",          2,  8,  8),
+    INSTRUCTION("RES 7,L",          2,  8,  8),
+    INSTRUCTION("RES 7,(HL)",       2, 16, 16),
+    INSTRUCTION("RES 7,A",          2,  8,  8),
+
+    //0xC0
+    INSTRUCTION("SET 0,B",          2,  8,  8),
+    INSTRUCTION("SET 0,C",          2,  8,  8),
+    INSTRUCTION("SET 0,D",          2,  8,  8),
+    INSTRUCTION("SET 0,E",          2,  8,  8),
+    INSTRUCTION("SET 0,H",          2,  8,  8),
+    INSTRUCTION("SET 0,L",          2,  8,  8),
+    INSTRUCTION("SET 0,(HL)",       2, 16, 16),
+    INSTRUCTION("SET 0,A",          2,  8,  8),
+    INSTRUCTION("SET 1,B",          2,  8,  8),
+    INSTRUCTION("SET 1,C",          2,  8,  8),
+    INSTRUCTION("SET 1,D",          2,  8,  8),
+    INSTRUCTION("SET 1,E",          2,  8,  8),
+    INSTRUCTION("SET 1,H",          2,  8,  8),
+    INSTRUCTION("SET 1,L",          2,  8,  8),
+    INSTRUCTION("SET 1,(HL)",       2, 16, 16),
+    INSTRUCTION("SET 1,A",          2,  8,  8),
+
+    //0xD0
+    INSTRUCTION("SET 2,B",          2,  8,  8),
+    INSTRUCTION("SET 2,C",          2,  8,  8),
+    INSTRUCTION("SET 2,D",          2,  8,  8),
+    INSTRUCTION("SET 2,E",          2,  8,  8),
+    INSTRUCTION("SET 2,H",          2,  8,  8),
+    INSTRUCTION("SET 2,L",          2,  8,  8),
+    INSTRUCTION("SET 2,(HL)",       2, 16, 16),
+    INSTRUCTION("SET 2,A",          2,  8,  8),
+    INSTRUCTION("SET 3,B",          2,  8,  8),
+    INSTRUCTION("SET 3,C",          2,  8,  8),
+    INSTRUCTION("SET 3,D",          2,  8,  8),
+    INSTRUCTION("SET 3,E",          2,  8,  8),
+    INSTRUCTION("SET 3,H",          2,  8,  8),
+    INSTRUCTION("SET 3,L",          2,  8,  8),
+    INSTRUCTION("SET 3,(HL)",       2, 16, 16),
+    INSTRUCTION("SET 3,A",          2,  8,  8),
+
+    //0xE0
+    INSTRUCTION("SET 4,B",          2,  8,  8),
+    INSTRUCTION("SET 4,C",          2,  8,  8),
+    INSTRUCTION("SET 4,D",          2,  8,  8),
+    INSTRUCTION("SET 4,E",          2,  8,  8),
+    INSTRUCTION("SET 4,H",          2,  8,  8),
+    INSTRUCTION("SET 4,L",          2,  8,  8),
+    INSTRUCTION("SET 4,(HL)",       2, 16, 16),
+    INSTRUCTION("SET 4,A",          2,  8,  8),
+    INSTRUCTION("SET 5,B",          2,  8,  8),
+    INSTRUCTION("SET 5,C",          2,  8,  8),
+    INSTRUCTION("SET 5,D",          2,  8,  8),
+    INSTRUCTION("SET 5,E",          2,  8,  8),
+    INSTRUCTION("SET 5,H",          2,  8,  8),
+    INSTRUCTION("SET 5,L",          2,  8,  8),
+    INSTRUCTION("SET 5,(HL)",       2, 16, 16),
+    INSTRUCTION("SET 5,A",          2,  8,  8),
+
+    //0xF0
+    INSTRUCTION("SET 6,B",          2,  8,  8),
+    INSTRUCTION("SET 6,C",          2,  8,  8),
+    INSTRUCTION("SET 6,D",          2,  8,  8),
+    INSTRUCTION("SET 6,E",          2,  8,  8),
+    INSTRUCTION("SET 6,H",          2,  8,  8),
+    INSTRUCTION("SET 6,L",          2,  8,  8),
+    INSTRUCTION("SET 6,(HL)",       2, 16, 16),
+    INSTRUCTION("SET 6,A",          2,  8,  8),
+    INSTRUCTION("SET 7,B",          2,  8,  8),
+    INSTRUCTION("SET 7,C",          2,  8,  8),
+    INSTRUCTION("SET 7,D",          2,  8,  8),
+    INSTRUCTION("SET 7,E",          2,  8,  8),
+    INSTRUCTION("SET 7,H",          2,  8,  8),
+    INSTRUCTION("SET 7,L",          2,  8,  8),
+    INSTRUCTION("SET 7,(HL)",       2, 16, 16),
+    INSTRUCTION("SET 7,A",          2,  8,  8)
+}};
@@ -0,0 +1,9 @@
+#include "core.hpp"
+
+#include "interrupt_controller.hpp"
+
+InterruptController::InterruptController()
+    : m_IF(0), m_IE(0), m_Pending(0)
+{
+    DEBUG("Initializing Interrupt Controller.");
+}
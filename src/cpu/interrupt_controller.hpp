@@ -0,0 +1,106 @@
+#pragma once
+
+#include "core.hpp"
+
+/**
+ * Owns the IF and IE registers, which the MMU maps into the IO space, and keeps
+ * the interrupts that are both requested and enabled up to date whenever either
+ * changes, so checking for one after every instruction is a single load
+**/
+class InterruptController
+{
+    public:
+        InterruptController();
+
+        /**
+         * @brief Gets the value of the IF register
+         * 
+         * @return The requested interrupts
+         */
+        [[nodiscard]] __always_inline auto getIF() const -> u8;
+
+        /**
+         * @brief Sets the value of the IF register
+         * 
+         * @param val The value to set
+         */
+        __always_inline void setIF(u8 val);
+
+        /**
+         * @brief Gets the value of the IE register
+         * 
+         * @return The enabled interrupts
+         */
+        [[nodiscard]] __always_inline auto getIE() const -> u8;
+
+        /**
+         * @brief Sets the value of the IE register
+         * 
+         * @param val The value to set
+         */
+        __always_inline void setIE(u8 val);
+
+        /**
+         * @brief Requests an interrupt by setting its bit in IF
+         * 
+         * @param flag The interrupt to request
+         */
+        __always_inline void request(u8 flag);
+
+        /**
+         * @brief Gets the interrupts that are both requested and enabled
+         * 
+         * @return IF & IE & 0x1F
+         */
+        [[nodiscard]] __always_inline auto getPending() const -> u8;
+    private:
+        /**
+         * @brief Works out the pending interrupts after IF or IE changed
+         * 
+         */
+        __always_inline void update();
+    private:
+        u8 m_IF;
+        u8 m_IE;
+        u8 m_Pending;
+};
+
+//--------------------------  Inline function implementations --------------------------//
+
+__always_inline auto InterruptController::getIF() const -> u8
+{
+    return m_IF;
+}
+
+__always_inline void InterruptController::setIF(u8 val)
+{
+    m_IF = val;
+    update();
+}
+
+__always_inline auto InterruptController::getIE() const -> u8
+{
+    return m_IE;
+}
+
+__always_inline void InterruptController::setIE(u8 val)
+{
+    m_IE = val;
+    update();
+}
+
+__always_inline void InterruptController::request(u8 flag)
+{
+    m_IF |= flag;
+    update();
+}
+
+__always_inline auto InterruptController::getPending() const -> u8
+{
+    return m_Pending;
+}
+
+__always_inline void InterruptController::update()
+{
+    m_Pending = m_IF & m_IE & 0x1F; //NOLINT(cppcoreguidelines-avoid-magic-numbers)
+}
@@ -0,0 +1,134 @@
+#include "core.hpp"
+
+#include "jit.hpp"
+
+#include "cpu.hpp"
+
+#ifdef JIT_RECOMPILER
+
+#include <cstring>
+
+#include <sys/mman.h>
+
+constexpr u32 CODE_BUFFER_SIZE  = 0x400000;
+
+constexpr u32 EPILOGUE_SIZE     = 2;  // pop rbx; ret
+constexpr u32 PROLOGUE_SIZE     = 4;  // push rbx; mov rbx, rdi
+constexpr u32 RECORD_SIZE       = 33; // mov word [rbx + PC], imm16; mov word [rbx + immediate], imm16; mov rdi, rbx; mov rax, imm64; call rax
+constexpr u32 CHECK_SIZE        = 18; // mov eax, imm32; cmp byte [rbx + invalidated], 0; jne epilogue
+constexpr u32 MAX_CODE_SIZE     = EPILOGUE_SIZE + PROLOGUE_SIZE + (RECORD_SIZE + CHECK_SIZE) * MAX_BLOCK_INSTRUCTIONS + EPILOGUE_SIZE;
+
+/**
+ * @brief Gets the offset of a member from the start of the cpu
+ *
+ * @param cpu The cpu the member belongs to
+ * @param member The member
+ * @return The offset in bytes
+ */
+static auto offsetIn(const CPU& cpu, const void* member) -> u32
+{
+    return static_cast<u32>(static_cast<const u8*>(member) - reinterpret_cast<const u8*>(&cpu));
+}
+
+JIT::JIT(CPU& cpu)
+    : m_Buffer(nullptr), m_Used(0),
+      m_PCOffset(offsetIn(cpu, &cpu.m_Registers.PC())),
+      m_ImmediateOffset(offsetIn(cpu, &cpu.m_Immediate)),
+      m_InvalidatedOffset(offsetIn(cpu, &cpu.m_BlockInvalidated))
+{
+    DEBUG("Initializing JIT.");
+
+    void* buffer = mmap(nullptr, CODE_BUFFER_SIZE, PROT_READ | PROT_WRITE | PROT_EXEC,
+                        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if(buffer == MAP_FAILED)
+    {
+        ERROR("Could not map " << CODE_BUFFER_SIZE << " bytes of executable memory for the JIT!");
+        return;
+    }
+
+    m_Buffer = static_cast<u8*>(buffer);
+}
+
+JIT::~JIT()
+{
+    if(m_Buffer) munmap(m_Buffer, CODE_BUFFER_SIZE);
+}
+
+auto JIT::isValid() const -> bool
+{
+    return m_Buffer;
+}
+
+auto JIT::compile(const BlockCache::Record* records, u8 count) -> BlockCache::Code
+{
+    if(m_Used + MAX_CODE_SIZE > CODE_BUFFER_SIZE) return nullptr;
+
+    // The epilogue goes first, so that leaving early is a backwards jump with a known offset
+    u32 epilogue = m_Used;
+    emit8(0x5B);                                            // pop rbx
+    emit8(0xC3);                                            // ret
+
+    u32 entry = m_Used;
+    emit8(0x53);                                            // push rbx
+    emit8(0x48); emit16(0xFB89);                            // mov rbx, rdi
+
+    for(u8 index = 0; index < count; ++index)
+    {
+        const BlockCache::Record& record = records[index];
+
+        emit8(0x66); emit16(0x83C7); emit32(m_PCOffset);    // mov word [rbx + PC], imm16
+        emit16(record.next);
+        emit8(0x66); emit16(0x83C7); emit32(m_ImmediateOffset); // mov word [rbx + immediate], imm16
+        emit16(record.immediate);
+        emit8(0x48); emit16(0xDF89);                        // mov rdi, rbx
+        emit16(0xB848);                                     // mov rax, imm64
+        emit64(reinterpret_cast<u64>(record.handler));
+        emit16(0xD0FF);                                     // call rax
+
+        emit8(0xB8); emit32(index);                         // mov eax, index
+
+        if(index + 1 < count)
+        {
+            emit16(0xBB80); emit32(m_InvalidatedOffset);    // cmp byte [rbx + invalidated], 0
+            emit8(0x00);
+            emit16(0x850F);                                 // jne epilogue
+            emit32(epilogue - (m_Used + sizeof(u32)));
+        }
+    }
+
+    emit8(0x5B);                                            // pop rbx
+    emit8(0xC3);                                            // ret
+
+    return reinterpret_cast<BlockCache::Code>(m_Buffer + entry);
+}
+
+void JIT::flush()
+{
+    m_Used = 0;
+}
+
+void JIT::emit8(u8 val)
+{
+    m_Buffer[m_Used++] = val;
+}
+
+void JIT::emit16(u16 val)
+{
+    std::memcpy(m_Buffer + m_Used, &val, sizeof(val));
+    m_Used += sizeof(val);
+}
+
+void JIT::emit32(u32 val)
+{
+    std::memcpy(m_Buffer + m_Used, &val, sizeof(val));
+    m_Used += sizeof(val);
+}
+
+void JIT::emit64(u64 val)
+{
+    std::memcpy(m_Buffer + m_Used, &val, sizeof(val));
+    m_Used += sizeof(val);
+}
+
+#endif
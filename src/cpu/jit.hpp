@@ -0,0 +1,56 @@
+#pragma once
+
+#include "core.hpp"
+
+#include "block_cache.hpp"
+
+class CPU;
+
+/**
+ * Compiles hot blocks from the block cache into x86-64 code that sets PC and
+ * the immediate and calls each opcode handler back to back, leaving the block
+ * early if a handler invalidated it
+**/
+class JIT
+{
+    public:
+        JIT(CPU& cpu);
+        ~JIT();
+
+        JIT(const JIT&) = delete;
+        auto operator=(const JIT&) -> JIT& = delete;
+
+        /**
+         * @brief Checks if the executable code buffer could be allocated
+         *
+         * @return If the JIT is usable
+         */
+        [[nodiscard]] auto isValid() const -> bool;
+
+        /**
+         * @brief Compiles the records of a block
+         *
+         * @param records The records of the block
+         * @param count The number of records
+         * @return The compiled code, or nullptr if the code buffer is full
+         */
+        auto compile(const BlockCache::Record* records, u8 count) -> BlockCache::Code;
+
+        /**
+         * @brief Throws away all compiled code
+         *
+         */
+        void flush();
+    private:
+        void emit8(u8 val);
+        void emit16(u16 val);
+        void emit32(u32 val);
+        void emit64(u64 val);
+    private:
+        u8* m_Buffer;
+        u32 m_Used;
+
+        u32 m_PCOffset;
+        u32 m_ImmediateOffset;
+        u32 m_InvalidatedOffset;
+};
@@ -2,8 +2,7 @@
 
 #include "core.hpp"
 
-#include <array>
-#include <variant>
+#include <iomanip>
 
 class Registers
 {
@@ -18,98 +17,98 @@ class Registers
          * 
          * @return The register by reference
          */
-        [[nodiscard]] auto A() -> u8&;
+        [[nodiscard]] __always_inline auto A() -> u8&;
 
         /**
          * @brief Gets the F register by reference
          * 
          * @return The register by reference 
          */
-        [[nodiscard]] auto F() -> u8&;
+        [[nodiscard]] __always_inline auto F() -> u8&;
 
         /**
          * @brief Gets the AF register by reference
          * 
          * @return The register by reference 
          */
-        [[nodiscard]] auto AF() -> u16&;
+        [[nodiscard]] __always_inline auto AF() -> u16&;
 
         /**
          * @brief Gets the B register by reference
          * 
          * @return The register by reference 
          */
-        [[nodiscard]] auto B() -> u8&;
+        [[nodiscard]] __always_inline auto B() -> u8&;
 
         /**
          * @brief Gets the C register by reference
          * 
          * @return The register by reference 
          */
-        [[nodiscard]] auto C() -> u8&;
+        [[nodiscard]] __always_inline auto C() -> u8&;
 
         /**
          * @brief Gets the BC register by reference
          * 
          * @return The register by reference 
          */
-        [[nodiscard]] auto BC() -> u16&;
+        [[nodiscard]] __always_inline auto BC() -> u16&;
 
         /**
          * @brief Gets the D register by reference
          * 
          * @return The register by reference 
          */
-        [[nodiscard]] auto D() -> u8&;
+        [[nodiscard]] __always_inline auto D() -> u8&;
 
         /**
          * @brief Gets the E register by reference
          * 
          * @return The register by reference 
          */
-        [[nodiscard]] auto E() -> u8&;
+        [[nodiscard]] __always_inline auto E() -> u8&;
 
         /**
          * @brief Gets the DE register by reference
          * 
          * @return The register by reference 
          */
-        [[nodiscard]] auto DE() -> u16&;
+        [[nodiscard]] __always_inline auto DE() -> u16&;
 
         /**
          * @brief Gets the H register by reference
          * 
          * @return The register by reference 
          */
-        [[nodiscard]] auto H() -> u8&;
+        [[nodiscard]] __always_inline auto H() -> u8&;
 
         /**
          * @brief Gets the L register by reference
          * 
          * @return The register by reference 
          */
-        [[nodiscard]] auto L() -> u8&;
+        [[nodiscard]] __always_inline auto L() -> u8&;
 
         /**
          * @brief Gets the HL register by reference
          * 
          * @return The register by reference 
          */
-        [[nodiscard]] auto HL() -> u16&;
+        [[nodiscard]] __always_inline auto HL() -> u16&;
 
         /**
          * @brief Gets the SP register by reference
          * 
          * @return The register by reference 
          */
-        [[nodiscard]] auto SP() -> u16&;
+        [[nodiscard]] __always_inline auto SP() -> u16&;
 
         /**
          * @brief Gets the PC register by reference
          * 
          * @return The register by reference 
          */
-        [[nodiscard]] auto PC() -> u16&;
+        [[nodiscard]] __always_inline auto PC() -> u16&;
 
         //-------------------------Const Versions-------------------------//
 
@@ -118,199 +117,300 @@ class Registers
          * 
          * @return The value in the register
          */
-        [[nodiscard]] auto A() const -> u8;
+        [[nodiscard]] __always_inline auto A() const -> u8;
 
         /**
          * @brief Gets the F register by value
          * 
          * @return The value in the register 
          */
-        [[nodiscard]] auto F() const -> u8;
+        [[nodiscard]] __always_inline auto F() const -> u8;
 
         /**
          * @brief Gets the AF register by value
          * 
          * @return The value in the register 
          */
-        [[nodiscard]] auto AF() const -> u16;
+        [[nodiscard]] __always_inline auto AF() const -> u16;
 
         /**
          * @brief Gets the B register by value
          * 
          * @return The value in the register 
          */
-        [[nodiscard]] auto B() const -> u8;
+        [[nodiscard]] __always_inline auto B() const -> u8;
 
         /**
          * @brief Gets the C register by value
          * 
          * @return The value in the register 
          */
-        [[nodiscard]] auto C() const -> u8;
+        [[nodiscard]] __always_inline auto C() const -> u8;
 
         /**
          * @brief Gets the BC register by value
          * 
          * @return The value in the register 
          */
-        [[nodiscard]] auto BC() const -> u16;
+        [[nodiscard]] __always_inline auto BC() const -> u16;
 
         /**
          * @brief Gets the D register by value
          * 
          * @return The value in the register 
          */
-        [[nodiscard]] auto D() const -> u8;
+        [[nodiscard]] __always_inline auto D() const -> u8;
 
         /**
          * @brief Gets the E register by value
          * 
          * @return The value in the register 
          */
-        [[nodiscard]] auto E() const -> u8;
+        [[nodiscard]] __always_inline auto E() const -> u8;
 
         /**
          * @brief Gets the DE register by value
          * 
          * @return The value in the register 
          */
-        [[nodiscard]] auto DE() const -> u16;
+        [[nodiscard]] __always_inline auto DE() const -> u16;
 
         /**
          * @brief Gets the H register by value
          * 
          * @return The value in the register 
          */
-        [[nodiscard]] auto H() const -> u8;
+        [[nodiscard]] __always_inline auto H() const -> u8;
 
         /**
          * @brief Gets the L register by value
          * 
          * @return The value in the register 
          */
-        [[nodiscard]] auto L() const -> u8;
+        [[nodiscard]] __always_inline auto L() const -> u8;
 
         /**
          * @brief Gets the HL register by value
          * 
          * @return The value in the register 
          */
-        [[nodiscard]] auto HL() const -> u16;
+        [[nodiscard]] __always_inline auto HL() const -> u16;
 
         /**
          * @brief Gets the SP register by value
          * 
          * @return The value in the register 
          */
-        [[nodiscard]] auto SP() const -> u16;
+        [[nodiscard]] __always_inline auto SP() const -> u16;
 
         /**
          * @brief Gets the PC register by value
          * 
          * @return The value in the register 
          */
-        [[nodiscard]] auto PC() const -> u16;
-
-        #ifndef UNSAFE
-        private:
-            using Register = std::variant<std::array<u8, 2>, u16>;
-
-            mutable Register af;
-            mutable Register bc;
-            mutable Register de;
-            mutable Register hl;
-            u16              sp;
-            u16              pc;
-
-        private:
-            /**
-             * @brief Get the high byte of the register by reference
-             * 
-             * @param reg The register to get the high byte from
-             * @return The updated register
-             */
-            [[nodiscard]] auto getHigh(Register& reg) -> u8&;
-
-            /**
-             * @brief Get the low byte of the register by reference
-             * 
-             * @param reg The register to get the low byte from
-             * @return The updated register
-             */
-            [[nodiscard]] auto getLow(Register& reg) -> u8&;
-
-            /**
-             * @brief Get both bytes from the register by reference
-             * 
-             * @param reg The register to get both bytes from
-             * @return The updated register
-             */
-            [[nodiscard]] auto getFull(Register& reg) -> u16&;
-
-        #else
-        private:
-            union
-            {
-                struct
-                {
-                    #ifdef IS_BIG_ENDIAN
-                    u8 a;
-                    u8 f;
-                    #else
-                    u8 f;
-                    u8 a;
-                    #endif
-                };
-                u16 af;
-            };
-
-            union
-            {
-                struct
-                {
-                    #ifdef IS_BIG_ENDIAN
-                    u8 b;
-                    u8 c;
-                    #else
-                    u8 c;
-                    u8 b;
-                    #endif
-                };
-                u16 bc;
-            };
-
-            union
-            {
-                struct
-                {
-                    #ifdef IS_BIG_ENDIAN
-                    u8 d;
-                    u8 e;
-                    #else
-                    u8 e;
-                    u8 d;
-                    #endif
-                };
-                u16 de;
-            };
-
-            union
-            {
-                struct
-                {
-                    #ifdef IS_BIG_ENDIAN
-                    u8 h;
-                    u8 l;
-                    #else
-                    u8 l;
-                    u8 h;
-                    #endif
-                };
-                u16 hl;
-            };
-
-            u16 sp;
-            u16 pc;
-
-        #endif
+        [[nodiscard]] __always_inline auto PC() const -> u16;
+
+    private:
+        /**
+         * @brief Get the high byte of a register pair by reference
+         * 
+         * @param reg The register pair to get the high byte from
+         * @return The high byte
+         */
+        [[nodiscard]] static __always_inline auto getHigh(u16& reg) -> u8&;
+
+        /**
+         * @brief Get the low byte of a register pair by reference
+         * 
+         * @param reg The register pair to get the low byte from
+         * @return The low byte
+         */
+        [[nodiscard]] static __always_inline auto getLow(u16& reg) -> u8&;
+
+        /**
+         * @brief Checks that the lower nibble of F is zero, as it is on hardware,
+         * whenever AF is read as a whole. Only does anything in debug builds
+         * 
+         */
+        __always_inline void validate() const;
+    private:
+        u16 af;
+        u16 bc;
+        u16 de;
+        u16 hl;
+        u16 sp;
+        u16 pc;
 };
+
+//--------------------------  Inline function implementations --------------------------//
+
+// The bytes of a pair are reached through a u8 pointer, which may alias
+// any object, so 8 and 16 bit accesses both go straight to memory
+#ifdef IS_BIG_ENDIAN
+    constexpr u8 HIGH_BYTE = 0;
+    constexpr u8 LOW_BYTE  = 1;
+#else
+    constexpr u8 HIGH_BYTE = 1;
+    constexpr u8 LOW_BYTE  = 0;
+#endif
+
+__always_inline auto Registers::getHigh(u16& reg) -> u8&
+{
+    return reinterpret_cast<u8*>(&reg)[HIGH_BYTE]; //NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+__always_inline auto Registers::getLow(u16& reg) -> u8&
+{
+    return reinterpret_cast<u8*>(&reg)[LOW_BYTE]; //NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+__always_inline void Registers::validate() const
+{
+    ASSERT(((af & 0x000F) == 0), "F Register has its lower nibble set: 0x" << std::setw(2) << std::setfill('0') << std::hex << (af & UINT8_MAX)); //NOLINT(cppcoreguidelines-avoid-magic-numbers)
+}
+
+//-------------------------Non-Const Versions-------------------------//
+
+__always_inline auto Registers::A() -> u8&
+{
+    return getHigh(af);
+}
+
+__always_inline auto Registers::F() -> u8&
+{
+    return getLow(af);
+}
+
+__always_inline auto Registers::AF() -> u16&
+{
+    validate();
+    return af;
+}
+
+__always_inline auto Registers::B() -> u8&
+{
+    return getHigh(bc);
+}
+
+__always_inline auto Registers::C() -> u8&
+{
+    return getLow(bc);
+}
+
+__always_inline auto Registers::BC() -> u16&
+{
+    return bc;
+}
+
+__always_inline auto Registers::D() -> u8&
+{
+    return getHigh(de);
+}
+
+__always_inline auto Registers::E() -> u8&
+{
+    return getLow(de);
+}
+
+__always_inline auto Registers::DE() -> u16&
+{
+    return de;
+}
+
+__always_inline auto Registers::H() -> u8&
+{
+    return getHigh(hl);
+}
+
+__always_inline auto Registers::L() -> u8&
+{
+    return getLow(hl);
+}
+
+__always_inline auto Registers::HL() -> u16&
+{
+    return hl;
+}
+
+__always_inline auto Registers::SP() -> u16&
+{
+    return sp;
+}
+
+__always_inline auto Registers::PC() -> u16&
+{
+    return pc;
+}
+
+//-------------------------Const Versions-------------------------//
+
+__always_inline auto Registers::A() const -> u8
+{
+    return static_cast<u8>(af >> CHAR_BIT);
+}
+
+__always_inline auto Registers::F() const -> u8
+{
+    return static_cast<u8>(af & UINT8_MAX);
+}
+
+__always_inline auto Registers::AF() const -> u16
+{
+    validate();
+    return af;
+}
+
+__always_inline auto Registers::B() const -> u8
+{
+    return static_cast<u8>(bc >> CHAR_BIT);
+}
+
+__always_inline auto Registers::C() const -> u8
+{
+    return static_cast<u8>(bc & UINT8_MAX);
+}
+
+__always_inline auto Registers::BC() const -> u16
+{
+    return bc;
+}
+
+__always_inline auto Registers::D() const -> u8
+{
+    return static_cast<u8>(de >> CHAR_BIT);
+}
+
+__always_inline auto Registers::E() const -> u8
+{
+    return static_cast<u8>(de & UINT8_MAX);
+}
+
+__always_inline auto Registers::DE() const -> u16
+{
+    return de;
+}
+
+__always_inline auto Registers::H() const -> u8
+{
+    return static_cast<u8>(hl >> CHAR_BIT);
+}
+
+__always_inline auto Registers::L() const -> u8
+{
+    return static_cast<u8>(hl & UINT8_MAX);
+}
+
+__always_inline auto Registers::HL() const -> u16
+{
+    return hl;
+}
+
+__always_inline auto Registers::SP() const -> u16
+{
+    return sp;
+}
+
+__always_inline auto Registers::PC() const -> u16
+{
+    return pc;
+}
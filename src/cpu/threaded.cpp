@@ -0,0 +1,142 @@
+#include "core.hpp"
+
+#include "cpu.hpp"
+
+#include "gameboy.hpp"
+
+#include "instruction_families.hpp"
+
+#include "logging/profiler.hpp"
+
+#ifdef THREADED_INTERPRETER
+
+#ifdef NDEBUG
+    #define LOG_OP(instruction) ((void)0) //NOLINT(cppcoreguidelines-macro-usage)
+#else
+    #define LOG_OP(instruction) OPCODE((instruction).mnemonic) //NOLINT(cppcoreguidelines-macro-usage)
+#endif
+
+// Expands M for every opcode in a row of the opcode table (0xh0 - 0xhF)
+//NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define OPCODE_ROW(M, h)                                                    \
+    M(h##0) M(h##1) M(h##2) M(h##3) M(h##4) M(h##5) M(h##6) M(h##7)         \
+    M(h##8) M(h##9) M(h##A) M(h##B) M(h##C) M(h##D) M(h##E) M(h##F)
+
+// Row 0xC0 - 0xCF, with the CB prefix left to the caller
+//NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define OPCODE_ROW_C(M, PREFIX)                                             \
+    M(0xC0) M(0xC1) M(0xC2) M(0xC3) M(0xC4) M(0xC5) M(0xC6) M(0xC7)         \
+    M(0xC8) M(0xC9) M(0xCA) PREFIX() M(0xCC) M(0xCD) M(0xCE) M(0xCF)
+
+//NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define OPCODES(M, PREFIX)                                                  \
+    OPCODE_ROW(M, 0x0) OPCODE_ROW(M, 0x1) OPCODE_ROW(M, 0x2) OPCODE_ROW(M, 0x3) \
+    OPCODE_ROW(M, 0x4) OPCODE_ROW(M, 0x5) OPCODE_ROW(M, 0x6) OPCODE_ROW(M, 0x7) \
+    OPCODE_ROW(M, 0x8) OPCODE_ROW(M, 0x9) OPCODE_ROW(M, 0xA) OPCODE_ROW(M, 0xB) \
+    OPCODE_ROW_C(M, PREFIX)                                                 \
+    OPCODE_ROW(M, 0xD) OPCODE_ROW(M, 0xE) OPCODE_ROW(M, 0xF)
+
+//NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define OPCODES_CB(M)                                                       \
+    OPCODE_ROW(M, 0x0) OPCODE_ROW(M, 0x1) OPCODE_ROW(M, 0x2) OPCODE_ROW(M, 0x3) \
+    OPCODE_ROW(M, 0x4) OPCODE_ROW(M, 0x5) OPCODE_ROW(M, 0x6) OPCODE_ROW(M, 0x7) \
+    OPCODE_ROW(M, 0x8) OPCODE_ROW(M, 0x9) OPCODE_ROW(M, 0xA) OPCODE_ROW(M, 0xB) \
+    OPCODE_ROW(M, 0xC) OPCODE_ROW(M, 0xD) OPCODE_ROW(M, 0xE) OPCODE_ROW(M, 0xF)
+
+#define LABEL(op)     &&op_##op, //NOLINT(cppcoreguidelines-macro-usage)
+#define LABEL_CB(op)  &&cb_##op, //NOLINT(cppcoreguidelines-macro-usage)
+#define LABEL_PREFIX() &&prefix_cb, //NOLINT(cppcoreguidelines-macro-usage)
+#define NO_PREFIX()                 //NOLINT(cppcoreguidelines-macro-usage)
+
+/**
+ * Fetches the next opcode and jumps straight to its handler. Every handler
+ * ends with its own copy of this, so each indirect jump gets its own slot
+ * in the branch predictor instead of all sharing one in a dispatch loop.
+**/
+//NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define DISPATCH()                                                          \
+    if(m_Halted)                                                            \
+    {                                                                       \
+        cycles = 4; /* Halted CPU takes 4 cycles */                         \
+        goto halted;                                                        \
+    }                                                                       \
+                                                                            \
+    start  = m_Registers.PC();                                              \
+    opcode = m_Gameboy.read(start);                                         \
+    PROFILE_OPCODE(opcode);                                                 \
+                                                                            \
+    if(!m_HaltBug)                                                          \
+    {                                                                       \
+        m_Registers.PC()++;                                                 \
+    }                                                                       \
+    else                                                                    \
+    {                                                                       \
+        m_HaltBug = false;                                                  \
+    }                                                                       \
+                                                                            \
+    ASSERT((handlers[opcode] || opcode == CB_OPCODE), "Opcode 0x" << std::setw(2) << std::setfill('0') << std::hex << static_cast<u16>(opcode) << ": " << instructions[opcode].mnemonic); \
+    LOG_OP(instructions[opcode]);                                           \
+    goto *labels[opcode]
+
+/**
+ * Accounts for the instruction that just finished, steps the rest
+ * of the Gameboy and either leaves or dispatches the next instruction
+**/
+//NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define NEXT(instruction, extraCycles)                                      \
+    cycles = (extraCycles) + (m_Branched ? (instruction).cyclesBranch       \
+                                         : (instruction).cyclesNoBranch);   \
+    m_Branched = false;                                                     \
+                                                                            \
+    handleInterrupts(cycles);                                               \
+    m_Gameboy.updateComponents(cycles);                                     \
+    spent += cycles;                                                        \
+                                                                            \
+    if(m_Registers.PC() <= start) /* Only a jump backwards can close a loop */ \
+    {                                                                       \
+        spent += m_Gameboy.runMemoryLoop(spent, budget);                    \
+        spent += m_Gameboy.skipIdleLoop(spent, budget);                     \
+    }                                                                       \
+                                                                            \
+    PROFILE_SAMPLE(start);                                                  \
+                                                                            \
+    if(spent >= budget) return spent;                                       \
+    DISPATCH()
+
+#define HANDLER(op)     op_##op: fetchImmediate(instructions[op].length); CPU::opcode<op>(); NEXT(instructions[op], 0); //NOLINT(cppcoreguidelines-macro-usage)
+#define HANDLER_CB(op)  cb_##op: opcodeCB<op>(); NEXT(instructionsCB[op], 4); //NOLINT(cppcoreguidelines-macro-usage)
+
+auto CPU::runThreaded(u32 budget) -> u32
+{
+    static void* const labels[0x100]   = { OPCODES(LABEL, LABEL_PREFIX) };
+    static void* const labelsCB[0x100] = { OPCODES_CB(LABEL_CB) };
+
+    u32 spent  = 0;
+    u8  cycles = 0;
+    u8  opcode = 0;
+    u16 start  = 0;
+
+    DISPATCH();
+
+halted:
+    handleInterrupts(cycles);
+    m_Gameboy.updateComponents(cycles);
+    spent += cycles;
+
+    spent += m_Gameboy.skipHalt(spent, budget);
+    PROFILE_SAMPLE(start);
+
+    if(spent >= budget) return spent;
+    DISPATCH();
+
+prefix_cb:
+    opcode = m_Gameboy.read(m_Registers.PC()++);
+    PROFILE_OPCODE_CB(opcode);
+    LOG_OP(instructionsCB[opcode]);
+    goto *labelsCB[opcode];
+
+    OPCODES(HANDLER, NO_PREFIX)
+    OPCODES_CB(HANDLER_CB)
+}
+
+#endif
@@ -7,8 +7,10 @@
 
 #include "gameboy.hpp"
 
+#include <algorithm>
+
 Timer::Timer(Gameboy& gb)
-    : m_Gameboy(gb), m_DIV(0), m_Counter(0), m_TIMA(0), m_Speed(TIMER_SPEED_00) {}
+    : m_Gameboy(gb), m_DIV(0), m_Counter(0), m_TIMA(0), m_Speed(TIMER_SPEED_00), m_TIMARegister(0) {}
 
 void Timer::update(u8 cycles)
 {
@@ -29,19 +31,16 @@ void Timer::update(u8 cycles)
         while (m_TIMA >= m_Speed)
         {
             m_TIMA -= m_Speed;
-            u8 tima = m_Gameboy.read(TIMER_TIMA_REGISTER);
 
-            if (tima == 0xFF)
+            if (m_TIMARegister == 0xFF)
             {
-                tima = m_Gameboy.read(TIMER_TMA_REGISTER);
+                m_TIMARegister = m_Gameboy.read(TIMER_TMA_REGISTER);
                 m_Gameboy.raiseInterrupt(Flags::Interrupt::Timer);
             }
             else
             {
-                tima++;
+                m_TIMARegister++;
             }
-
-            m_Gameboy.write(TIMER_TIMA_REGISTER, tima);
         }
     }
 }
@@ -57,7 +56,32 @@ void Timer::resetDiv()
     m_TIMA = 0;
 }
 
+auto Timer::getTIMA() -> u8
+{
+    return m_TIMARegister;
+}
+
+void Timer::setTIMA(u8 val)
+{
+    m_TIMARegister = val;
+}
+
 void Timer::setSpeed(u32 speed)
 {
     m_Speed = speed;
 }
+
+auto Timer::getCyclesUntilEvent(bool increments) const -> u32
+{
+    u32 cycles = increments ? 0x0100 - m_Counter : UINT32_MAX;
+
+    if(bit_functions::get_bit(m_Gameboy.read(TIMER_TAC_REGISTER), 2))
+    {
+        u32 next = m_TIMA < m_Speed ? m_Speed - m_TIMA : 0;
+
+        // TIMA overflows on the increment after it reaches 0xFF
+        cycles = std::min(cycles, increments ? next : next + (0xFF - m_TIMARegister) * m_Speed);
+    }
+
+    return cycles;
+}
@@ -28,12 +28,32 @@ class Timer
          */
         void resetDiv();
 
+        /**
+         * @brief Gets the value of the TIMA register
+         * 
+         */
+        auto getTIMA() -> u8;
+
+        /**
+         * @brief Sets the value of the TIMA register
+         * 
+         * @param val The value to set
+         */
+        void setTIMA(u8 val);
+
         /**
          * @brief Set the speed of the timer
          * 
          * @param speed The speed to be set
          */
         void setSpeed(u32 speed);
+
+        /**
+         * @brief Gets the number of cycles until the timer next changes memory
+         * 
+         * @param increments If DIV and TIMA increments count, not just TIMA overflowing
+         */
+        [[nodiscard]] auto getCyclesUntilEvent(bool increments) const -> u32;
     private:
         Gameboy& m_Gameboy;
 
@@ -41,4 +61,6 @@ class Timer
         u32 m_Counter;
         u32 m_TIMA;
         u32 m_Speed;
+
+        u8 m_TIMARegister;
 };
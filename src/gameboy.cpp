@@ -2,11 +2,86 @@
 
 #include "gameboy.hpp"
 
+#include <algorithm>
+
 Gameboy::Gameboy()
     :   m_MMU(*this), m_APU(*this), m_CPU(*this), m_PPU(*this),
-        m_Cycles(0), m_Timer(*this), m_Path(""), m_Running(false)
+        m_Synced(0), m_Syncing(false),
+        m_Cycles(0), m_TimerReads(0), m_IdleTimerReads(0), m_IdleEvent(0), m_IdleTimerEvent(0),
+        m_Timer(*this), m_Path(""), m_Running(false)
 {
-    m_PPU.setDrawCallback([screen = &m_Screen](std::array<u8, FRAME_BUFFER_SIZE> buffer) { screen->draw(buffer); });
+    m_PPU.setDrawCallback([screen = &m_Screen](Frame frame) { screen->draw(frame); });
+    mapIORegisters();
+}
+
+void Gameboy::mapIORegisters()
+{
+    m_MMU.mapIO(JOYPAD_REGISTER, {
+        .read  = [](Gameboy& gb) { return gb.getInput(); },
+        .write = [](Gameboy& gb, u8 val) { gb.setInput(val); } });
+
+    // DIV and TIMA count up between syncs, so the timer is caught up before they are read
+    m_MMU.mapIO(TIMER_DIV_REGISTER, {
+        .read  = [](Gameboy& gb) { gb.m_TimerReads++; gb.syncComponents(); return gb.getDIV(); },
+        .write = [](Gameboy& gb, [[maybe_unused]] u8 val) { gb.resetDiv(); },
+        .sync  = true });
+
+    m_MMU.mapIO(TIMER_TIMA_REGISTER, {
+        .read  = [](Gameboy& gb) { gb.m_TimerReads++; gb.syncComponents(); return gb.getTIMA(); },
+        .write = [](Gameboy& gb, u8 val) { gb.setTIMA(val); },
+        .sync  = true });
+
+    m_MMU.mapIO(TIMER_TAC_REGISTER, {
+        .write = [](Gameboy& gb, u8 val)
+        {
+            switch(val & 0b11)
+            {
+                case 0b00:
+                    gb.setTimerSpeed(TIMER_SPEED_00);
+                    break;
+                case 0b01:
+                    gb.setTimerSpeed(TIMER_SPEED_01);
+                    break;
+                case 0b10:
+                    gb.setTimerSpeed(TIMER_SPEED_10);
+                    break;
+                case 0b11:
+                    gb.setTimerSpeed(TIMER_SPEED_11);
+                    break;
+                default:
+                    ASSERT(false, "Timer Speed Switch branched to invalid case!");
+            }
+        },
+        .sync  = true });
+
+    m_MMU.mapIO(IF_REGISTER, {
+        .read  = [](Gameboy& gb) { return gb.getIF(); },
+        .write = [](Gameboy& gb, u8 val) { gb.setIF(val); } });
+
+    // The mode and LYC=LY bits of STAT and all of LY are only set by the PPU
+    m_MMU.mapIO(LCD_CONTROL_REGISTER, { .sync = true });
+    m_MMU.mapIO(LCD_STAT_REGISTER,    { .writeMask = 0b11111000 });
+    m_MMU.mapIO(LY_REGISTER,          { .writeMask = 0 });
+
+    m_MMU.mapIO(DMA_TRANSFER_REGISTER, {
+        .write = [](Gameboy& gb, u8 val) { gb.m_MMU.dmaTransfer(val); } });
+
+    // The palettes are only looked up again when they change, after the lines before the write are drawn
+    m_MMU.mapIO(BG_PALLETTE_REGISTER, {
+        .write = [](Gameboy& gb, u8 val) { gb.m_PPU.setPalette(Colour::Palette::Background, val); },
+        .sync  = true });
+
+    m_MMU.mapIO(OBJ_0_PALLETTE_REGISTER, {
+        .write = [](Gameboy& gb, u8 val) { gb.m_PPU.setPalette(Colour::Palette::Object0, val); },
+        .sync  = true });
+
+    m_MMU.mapIO(OBJ_1_PALLETTE_REGISTER, {
+        .write = [](Gameboy& gb, u8 val) { gb.m_PPU.setPalette(Colour::Palette::Object1, val); },
+        .sync  = true });
+
+    m_MMU.mapIO(BOOT_REGISTER, {
+        .read  = [](Gameboy& gb) -> u8 { return gb.m_MMU.isBootEnabled() ? 0 : 1; },
+        .write = [](Gameboy& gb, u8 val) { gb.m_MMU.setBootEnabled(val == 0); } });
 }
 
 void Gameboy::reset()
@@ -17,6 +92,10 @@ void Gameboy::reset()
     {
         m_MMU.write(BOOT_REGISTER, 0);
     }
+    else // The boot rom would have left BGP set
+    {
+        m_MMU.write(BG_PALLETTE_REGISTER, BGP_RESET);
+    }
     
     m_CPU.reset();
 }
@@ -59,23 +138,172 @@ void Gameboy::start()
 
 void Gameboy::tick()
 {
-    u8 cycles = m_CPU.tick();
-    m_CPU.handleInterrupts(cycles);
-    m_Timer.update(cycles);
-    m_PPU.tick(cycles);
-    
-    m_Cycles += cycles;
+    m_Cycles += m_CPU.run(1);
 }
 
 void Gameboy::renderFrame()
 {
-    while(m_Cycles <= CYCLES_PER_FRAME)
+    m_Cycles += m_CPU.run(CYCLES_PER_FRAME + 1 - m_Cycles);
+
+    m_Cycles -= CYCLES_PER_FRAME;
+    m_CPU.resetIdleLoop();
+}
+
+auto Gameboy::skipIdleLoop(u32 now, u32 end) -> u32
+{
+    u32 period = m_CPU.checkIdleLoop(now);
+
+    // Only a loop that reads the timer can see it count up
+    bool readsTimer = m_TimerReads != m_IdleTimerReads;
+    m_IdleTimerReads = m_TimerReads;
+
+    // An event during the last iteration may change what the next one sees
+    bool quiet = now < (readsTimer ? m_IdleTimerEvent : m_IdleEvent);
+
+    u32 until = getCyclesUntilEvent(now);
+    m_IdleEvent = now + until;
+
+    // Timer increments aren't scheduled, so the timer has to be caught up to know when the next one is
+    if(readsTimer)
     {
-        tick();
+        syncComponents();
+        m_IdleTimerEvent = now + std::min(until, m_Timer.getCyclesUntilEvent(true));
+    }
+    else
+    {
+        m_IdleTimerEvent = now;
     }
 
-    m_Cycles -= CYCLES_PER_FRAME;
+    if(!period || !quiet || now >= end) return 0;
+
+    // A pending interrupt has to be taken before the loop goes around again
+    if(getPendingInterrupts()) return 0;
+
+    until = std::min((readsTimer ? m_IdleTimerEvent : m_IdleEvent) - now, end - now);
+    if(until <= period) return 0;
+
+    // Every skipped iteration has to finish before the event, the iteration
+    // that sees it is left to the cpu
+    u32 skipped = (until - 1) / period * period;
+
+    updateComponents(skipped);
+    m_CPU.skipIdleLoop(skipped);
+    return skipped;
+}
+
+auto Gameboy::skipHalt(u32 now, u32 end) -> u32
+{
+    u32 skipped = 0;
+
+    // Only a PPU mode change or the timer overflowing can raise an interrupt while halted,
+    // and the joypad is only read between frames
+    while(m_CPU.isHalted() && now + skipped < end)
+    {
+        u32 until = std::min(getCyclesUntilEvent(now + skipped), end - now - skipped);
+
+        // A halted cpu takes 4 cycles at a time, the last of which reaches the event
+        until = (until + 3) / 4 * 4; //NOLINT(cppcoreguidelines-avoid-magic-numbers)
+
+        updateComponents(until);
+        skipped += until;
+    }
+
+    return skipped;
+}
+
+auto Gameboy::runMemoryLoop(u32 now, u32 end) -> u32
+{
+    u32 period = m_CPU.checkMemoryLoop();
+    if(!period || now >= end) return 0;
+
+    // A pending interrupt has to be taken before the loop goes around again
+    if(getPendingInterrupts()) return 0;
+
+    // The loop only touches plain memory, so only an overflow can change what the timer does to it
+    u32 until = std::min(getCyclesUntilEvent(now), end - now);
+    if(until <= period) return 0;
+
+    // Every iteration has to finish before the event, the iteration that sees it is left to the cpu
+    u32 cycles = m_CPU.runMemoryLoop((until - 1) / period) * period;
+
+    updateComponents(cycles);
+    return cycles;
+}
+
+void Gameboy::syncComponents()
+{
+    if(m_Syncing) return;
+    m_Syncing = true;
+
+    u64 now = m_Scheduler.getTimestamp();
+
+    // Fine as long as no component has more than one event within the cycles,
+    // which holds as they are stepped once the first one is due
+    while(m_Synced < now)
+    {
+        u8 step = static_cast<u8>(std::min<u64>(now - m_Synced, UINT8_MAX));
+        m_Timer.update(step);
+        m_PPU.tick(step);
+        m_Synced += step;
+    }
+
+    m_Scheduler.schedule(Scheduler::Event::PPU,   now + m_PPU.getCyclesUntilEvent());
+    m_Scheduler.schedule(Scheduler::Event::Timer, now + m_Timer.getCyclesUntilEvent(false));
+    m_Scheduler.schedule(Scheduler::Event::Sync,  Scheduler::NEVER);
+
+    m_MMU.updateDma(now);
+    m_Scheduler.schedule(Scheduler::Event::DMA,   m_MMU.getDmaEnd());
+
+    m_Syncing = false;
+}
+
+void Gameboy::setInterpreter(Interpreter interpreter)
+{
+    #ifndef THREADED_INTERPRETER
+        if(interpreter == Interpreter::Threaded)
+        {
+            WARN("Shatter was built without the threaded interpreter, falling back to the table interpreter.");
+            interpreter = Interpreter::Table;
+        }
+    #endif
+
+    #ifndef JIT_RECOMPILER
+        if(interpreter == Interpreter::JIT)
+        {
+            WARN("Shatter was built without the JIT, falling back to the block cache.");
+            interpreter = Interpreter::Cached;
+        }
+    #endif
+
+    if(interpreter == Interpreter::Cached || interpreter == Interpreter::JIT)
+    {
+        if(!m_CPU.enableBlockCache(interpreter == Interpreter::JIT))
+        {
+            WARN("Could not allocate memory for the JIT, falling back to the block cache.");
+            interpreter = Interpreter::Cached;
+        }
+    }
+
+    m_CPU.setInterpreter(interpreter);
+}
+
+void Gameboy::setDmaTiming(bool timed)
+{
+    m_MMU.setDmaTiming(timed);
+}
+
+void Gameboy::setColourScheme(Colour::Scheme scheme)
+{
+    m_PPU.setColourScheme(scheme);
+}
+
+#ifdef GUEST_PROFILER
+void Gameboy::enableProfiler(const std::string& path, u32 interval)
+{
+    DEBUG("Profiling to " << path << ".");
+    m_CPU.enableProfiler(path, interval);
 }
+#endif
 
 void Gameboy::stop()
 {
@@ -2,17 +2,21 @@
 
 #include "core.hpp"
 
+#include <algorithm>
+
 #include "audio/apu.hpp"
 
 #include "mmu.hpp"
 
 #include "cpu/cpu.hpp"
+#include "cpu/interrupt_controller.hpp"
 #include "cpu/timer.hpp"
 
 #include "video/screen.hpp"
 #include "video/ppu.hpp"
 
 #include "joypad.hpp"
+#include "scheduler.hpp"
 #include "video/video_defs.hpp"
 
 class Gameboy
@@ -68,6 +72,122 @@ class Gameboy
          */
         void renderFrame();
 
+        /**
+         * @brief Checks if the cpu just went around an idle loop, and if so
+         * skips as many iterations of it as fit before the next PPU or
+         * timer event, stepping every other component by the same amount
+         * 
+         * @param now The number of cycles emulated so far
+         * @param end The cycle count that may not be reached by skipping
+         * @return The number of cycles that were skipped
+         */
+        auto skipIdleLoop(u32 now, u32 end) -> u32;
+
+        /**
+         * @brief Fast forwards a halted cpu to the next event that can raise an interrupt,
+         * instead of stepping every component 4 cycles at a time
+         * 
+         * @param now The number of cycles emulated so far
+         * @param end The cycle count to stop at if the cpu is still halted
+         * @return The number of cycles that were skipped
+         */
+        auto skipHalt(u32 now, u32 end) -> u32;
+
+        /**
+         * @brief Checks if the cpu is at the head of a copy or fill loop, and if so
+         * runs as many iterations of it as fit before the next PPU or timer event
+         * as one copy or fill, stepping every other component by the same amount
+         * 
+         * @param now The number of cycles emulated so far
+         * @param end The cycle count that may not be reached by the loop
+         * @return The number of cycles the iterations took
+         */
+        auto runMemoryLoop(u32 now, u32 end) -> u32;
+
+        /**
+         * @brief Moves the master cycle count forward by the cycles the last
+         * instruction took, stepping every component other than the cpu
+         * if one of them has an event due
+         * 
+         * @param cycles The number of cycles that have passed
+         */
+        __always_inline void updateComponents(u32 cycles);
+
+        /**
+         * @brief Steps every component other than the cpu up to the master cycle count
+         * and schedules their next events, for before one of their registers is accessed
+         * 
+         */
+        void syncComponents();
+
+        /**
+         * @brief Makes the components get stepped right after the current instruction,
+         * for after one of their registers was written
+         * 
+         */
+        __always_inline void scheduleSync();
+
+        /**
+         * @brief Checks if the components are being stepped, as opposed to the cpu running
+         * 
+         * @return If the components are being stepped
+         */
+        [[nodiscard]] __always_inline auto isSyncing() const -> bool;
+
+        /**
+         * @brief Decodes a row of a tile in the PPU's tile cache after its tile data was written
+         * 
+         * @param address The address of the row in vram
+         * @param low The first byte of the row
+         * @param high The second byte of the row
+         */
+        __always_inline void updateTile(u16 address, u8 low, u8 high);
+
+        /**
+         * @brief Sets if OAM DMA takes its 640 cycles instead of being instant, see MMU::setDmaTiming
+         * 
+         * @param timed If transfers are timed
+         */
+        void setDmaTiming(bool timed);
+
+        /**
+         * @brief Sets the host colours the four shades are shown as
+         * 
+         * @param scheme The colour scheme
+         */
+        void setColourScheme(Colour::Scheme scheme);
+
+        /**
+         * @brief Borrows the last frame the PPU completed, see PPU::getFrame
+         * 
+         * @return The frame
+         */
+        [[nodiscard]] __always_inline auto getFrame() const -> Frame;
+
+        /**
+         * @brief Sets the interpreter the cpu executes instructions with
+         * 
+         * @param interpreter The interpreter to use
+         */
+        void setInterpreter(Interpreter interpreter);
+
+        #ifdef GUEST_PROFILER
+        /**
+         * @brief Starts profiling the guest code, see Profiler
+         * 
+         * @param path The filepath of the report
+         * @param interval The number of cycles between samples
+         */
+        void enableProfiler(const std::string& path, u32 interval);
+        #endif
+
+        /**
+         * @brief Gets the master cycle count
+         * 
+         * @return The number of cycles emulated since startup
+         */
+        [[nodiscard]] __always_inline auto getTimestamp() const -> u64;
+
         /**
          * @brief Stops the Gameboy
          * 
@@ -97,6 +217,26 @@ class Gameboy
          */
         __always_inline void write(u16 address, u8 val);
 
+        /**
+         * @brief Copies a block of plain memory, see MMU::copy
+         * 
+         * @param dst The address to copy to
+         * @param src The address to copy from
+         * @param length The number of bytes to copy
+         * @return If the block could be copied
+         */
+        __always_inline auto copy(u16 dst, u16 src, u16 length) -> bool;
+
+        /**
+         * @brief Fills a block of plain memory, see MMU::fill
+         * 
+         * @param dst The address to fill from
+         * @param val The value to fill with
+         * @param length The number of bytes to fill
+         * @return If the block could be filled
+         */
+        __always_inline auto fill(u16 dst, u8 val, u16 length) -> bool;
+
         /**
          * @brief Returns if the bootrom is enabled
          * 
@@ -104,6 +244,33 @@ class Gameboy
          */
         [[nodiscard]] __always_inline auto isBootEnabled() const -> u8;
 
+        /**
+         * @brief Gets the rom bank currently mapped to 0x4000 - 0x7FFF
+         * 
+         * @return The current rom bank
+         */
+        [[nodiscard]] __always_inline auto getRomBank() const -> u16;
+
+        /**
+         * @brief Marks the region of ram containing an address as holding cached code
+         * 
+         * @param address The address in ram
+         */
+        __always_inline void markCode(u16 address);
+
+        /**
+         * @brief Throws away any cached code in the region of ram containing an address
+         * 
+         * @param address The address that was written to
+         */
+        __always_inline void invalidateCode(u16 address);
+
+        /**
+         * @brief Notifies the cpu that the rom bank mapped to 0x4000 - 0x7FFF changed
+         * 
+         */
+        __always_inline void switchedBank();
+
         /**
          * @brief Gets the status of the IME (interrupt master enable)
          * 
@@ -125,6 +292,46 @@ class Gameboy
          */
         __always_inline void raiseInterrupt(const Flags::Interrupt& flag);
 
+        /**
+         * @brief Sets the bit of an interrupt in IF, without waking up the cpu
+         * 
+         * @param flag The interrupt to request
+         */
+        __always_inline void requestInterrupt(u8 flag);
+
+        /**
+         * @brief Gets the interrupts that are both requested and enabled
+         * 
+         * @return IF & IE & 0x1F
+         */
+        [[nodiscard]] __always_inline auto getPendingInterrupts() const -> u8;
+
+        /**
+         * @brief Gets the value of the IF register
+         * 
+         */
+        [[nodiscard]] __always_inline auto getIF() const -> u8;
+
+        /**
+         * @brief Sets the value of the IF register
+         * 
+         * @param val The value to set
+         */
+        __always_inline void setIF(u8 val);
+
+        /**
+         * @brief Gets the value of the IE register
+         * 
+         */
+        [[nodiscard]] __always_inline auto getIE() const -> u8;
+
+        /**
+         * @brief Sets the value of the IE register
+         * 
+         * @param val The value to set
+         */
+        __always_inline void setIE(u8 val);
+
         /**
          * @brief Presses a button on the joypad
          * 
@@ -170,6 +377,19 @@ class Gameboy
          */
         __always_inline void resetDiv();
 
+        /**
+         * @brief Gets the value of the TIMA register
+         * 
+         */
+        __always_inline auto getTIMA() -> u8;
+
+        /**
+         * @brief Sets the value of the TIMA register
+         * 
+         * @param val The value to set
+         */
+        __always_inline void setTIMA(u8 val);
+
         /**
          * @brief Sets the speed of the timer
          * 
@@ -216,16 +436,39 @@ class Gameboy
          * 
          */
         __always_inline auto getRenderingScale() const -> u32;
+    private:
+        /**
+         * @brief Gets the number of cycles until the next event of any component
+         * 
+         * @param now The number of cycles emulated so far
+         * @return The number of cycles, clamped so that adding them to now can't overflow
+         */
+        [[nodiscard]] __always_inline auto getCyclesUntilEvent(u32 now) const -> u32;
+
+        /**
+         * @brief Registers the handlers of every component's IO registers with the MMU
+         * 
+         */
+        void mapIORegisters();
     private:
         MMU m_MMU;
         APU m_APU;
         CPU m_CPU;
         PPU m_PPU;
 
+        Scheduler m_Scheduler;
+        u64 m_Synced;           // The master cycle count the components were last stepped to
+        bool m_Syncing;
+
         u32 m_Cycles;
+        u32 m_TimerReads;       // DIV and TIMA reads, so idle loop detection can tell if a loop waits on the timer
+        u32 m_IdleTimerReads;
+        u32 m_IdleEvent;        // When the next event is due, as of the last loop iteration
+        u32 m_IdleTimerEvent;   // The same, counting every timer increment as an event
 
         Joypad m_Joypad;
         Timer  m_Timer;
+        InterruptController m_Interrupts;
         Screen m_Screen;
 
         std::string m_Path;
@@ -235,6 +478,43 @@ class Gameboy
 
 //--------------------------  Inline function implementations --------------------------//
 
+__always_inline void Gameboy::updateComponents(u32 cycles)
+{
+    if(m_Scheduler.advance(cycles))
+    {
+        syncComponents();
+    }
+}
+
+__always_inline auto Gameboy::getTimestamp() const -> u64
+{
+    return m_Scheduler.getTimestamp();
+}
+
+__always_inline auto Gameboy::isSyncing() const -> bool
+{
+    return m_Syncing;
+}
+
+__always_inline void Gameboy::updateTile(u16 address, u8 low, u8 high)
+{
+    m_PPU.updateTile(address, low, high);
+}
+
+__always_inline void Gameboy::scheduleSync()
+{
+    // The components write their own registers while they are being stepped
+    if(!m_Syncing)
+    {
+        m_Scheduler.schedule(Scheduler::Event::Sync, m_Scheduler.getTimestamp());
+    }
+}
+
+__always_inline auto Gameboy::getCyclesUntilEvent(u32 now) const -> u32
+{
+    return static_cast<u32>(std::min<u64>(m_Scheduler.getCyclesUntilEvent(), UINT32_MAX - now));
+}
+
 __always_inline auto Gameboy::read(u16 address) const -> u8
 {
     return m_MMU.read(address);
@@ -245,11 +525,41 @@ __always_inline void Gameboy::write(u16 address, u8 val)
     m_MMU.write(address, val);
 }
 
+__always_inline auto Gameboy::copy(u16 dst, u16 src, u16 length) -> bool
+{
+    return m_MMU.copy(dst, src, length);
+}
+
+__always_inline auto Gameboy::fill(u16 dst, u8 val, u16 length) -> bool
+{
+    return m_MMU.fill(dst, val, length);
+}
+
 __always_inline auto Gameboy::isBootEnabled() const -> u8
 {
     return m_MMU.isBootEnabled();
 }
 
+__always_inline auto Gameboy::getRomBank() const -> u16
+{
+    return m_MMU.getRomBank();
+}
+
+__always_inline void Gameboy::markCode(u16 address)
+{
+    m_MMU.markCode(address);
+}
+
+__always_inline void Gameboy::invalidateCode(u16 address)
+{
+    m_CPU.invalidateCode(address);
+}
+
+__always_inline void Gameboy::switchedBank()
+{
+    m_CPU.switchedBank();
+}
+
 __always_inline auto Gameboy::getIME() const -> bool
 {
     return m_CPU.getIME();
@@ -265,6 +575,36 @@ __always_inline void Gameboy::raiseInterrupt(const Flags::Interrupt& flag)
     m_CPU.raiseInterrupt(flag);
 }
 
+__always_inline void Gameboy::requestInterrupt(u8 flag)
+{
+    m_Interrupts.request(flag);
+}
+
+__always_inline auto Gameboy::getPendingInterrupts() const -> u8
+{
+    return m_Interrupts.getPending();
+}
+
+__always_inline auto Gameboy::getIF() const -> u8
+{
+    return m_Interrupts.getIF();
+}
+
+__always_inline void Gameboy::setIF(u8 val)
+{
+    m_Interrupts.setIF(val);
+}
+
+__always_inline auto Gameboy::getIE() const -> u8
+{
+    return m_Interrupts.getIE();
+}
+
+__always_inline void Gameboy::setIE(u8 val)
+{
+    m_Interrupts.setIE(val);
+}
+
 __always_inline void Gameboy::press(Button button)
 {
     m_Joypad.press(button);
@@ -302,6 +642,16 @@ __always_inline void Gameboy::resetDiv()
     m_Timer.resetDiv();
 }
 
+__always_inline auto Gameboy::getTIMA() -> u8
+{
+    return m_Timer.getTIMA();
+}
+
+__always_inline void Gameboy::setTIMA(u8 val)
+{
+    m_Timer.setTIMA(val);
+}
+
 __always_inline void Gameboy::setTimerSpeed(u32 speed)
 {
     m_Timer.setSpeed(speed);
@@ -312,6 +662,11 @@ __always_inline auto Gameboy::getVideoMode() const -> VideoMode
     return m_PPU.getMode();
 }
 
+__always_inline auto Gameboy::getFrame() const -> Frame
+{
+    return m_PPU.getFrame();
+}
+
 __always_inline void Gameboy::setTitle(std::string title)
 {
     m_Screen.setTitle(title);
@@ -336,3 +691,9 @@ __always_inline auto Gameboy::getRenderingScale() const -> u32
 {
     return m_Screen.getRenderingScale();
 }
+
+__always_inline void CPU::write(u16 address, u8 val)
+{
+    m_Writes++;
+    m_Gameboy.write(address, val);
+}
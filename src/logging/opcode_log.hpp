@@ -9,10 +9,10 @@
 #define LOG_H_REG() OPCODE("H Register updated to: 0x" << std::setw(2) << std::setfill('0') << std::hex << static_cast<u16>(m_Registers.H()) << ".")
 #define LOG_L_REG() OPCODE("L Register updated to: 0x" << std::setw(2) << std::setfill('0') << std::hex << static_cast<u16>(m_Registers.L()) << ".")
 
-#define LOG_FLAGS() OPCODE("Flags updated to: " << ((m_Registers.F() & Flags::Register::Zero)      ? "Z" : "_") \
-                                                << ((m_Registers.F() & Flags::Register::Negative)  ? "N" : "_") \
-                                                << ((m_Registers.F() & Flags::Register::HalfCarry) ? "H" : "_") \
-                                                << ((m_Registers.F() & Flags::Register::Carry)     ? "C" : "_") \
+#define LOG_FLAGS() OPCODE("Flags updated to: " << ((peekFlags() & Flags::Register::Zero)          ? "Z" : "_") \
+                                                << ((peekFlags() & Flags::Register::Negative)      ? "N" : "_") \
+                                                << ((peekFlags() & Flags::Register::HalfCarry)     ? "H" : "_") \
+                                                << ((peekFlags() & Flags::Register::Carry)         ? "C" : "_") \
                                                 << ".")
 
 #define LOG_AF_REG() OPCODE("AF Register updated to: 0x" << std::setw(4) << std::setfill('0') << std::hex << m_Registers.AF() << ".")
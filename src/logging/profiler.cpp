@@ -0,0 +1,155 @@
+#include "core.hpp"
+
+#include "profiler.hpp"
+
+#include "gameboy.hpp"
+
+#ifdef GUEST_PROFILER
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+constexpr u32 MAX_FRAMES     = 0x100;
+constexpr u32 MAX_REPORT_PCS = 0x40;
+
+Profiler::Profiler(Gameboy& gb, std::string path, u32 interval)
+    : m_Gameboy(gb), m_Path(std::move(path)), m_Interval(std::max<u32>(interval, 1)),
+      m_NextSample(gb.getTimestamp() + m_Interval), m_Samples(0),
+      m_Opcodes({}), m_OpcodesCB({})
+{
+    DEBUG("Initializing profiler, sampling every " << m_Interval << " cycles.");
+    m_Frames.reserve(MAX_FRAMES);
+}
+
+Profiler::~Profiler()
+{
+    writeReport();
+    writeFolded();
+}
+
+void Profiler::sample(u16 pc)
+{
+    u64 now = m_Gameboy.getTimestamp();
+    if(now < m_NextSample) return;
+
+    // Skipped idle loops and halts cover many intervals at once
+    u64 samples  = (now - m_NextSample) / m_Interval + 1;
+    m_NextSample += samples * m_Interval;
+    m_Samples    += samples;
+
+    u32 key = getKey(pc);
+    m_PCs[key] += samples;
+
+    std::string stack = "main";
+    for(const Frame& frame : m_Frames)
+    {
+        stack += ';' + format(frame.routine);
+    }
+
+    m_Stacks[stack + ';' + format(key)] += samples;
+}
+
+void Profiler::call(u16 pc, u16 sp)
+{
+    // Routines that were left without a return (e.g. by popping the return address) are gone
+    ret(sp + 1);
+
+    if(m_Frames.size() < MAX_FRAMES)
+    {
+        m_Frames.push_back({ getKey(pc), sp });
+    }
+}
+
+void Profiler::ret(u16 sp)
+{
+    while(!m_Frames.empty() && m_Frames.back().sp < sp)
+    {
+        m_Frames.pop_back();
+    }
+}
+
+auto Profiler::getKey(u16 pc) const -> u32
+{
+    u32 bank = (ROM_BANK_OFFSET <= pc && pc < ROM_END_ADDR) ? m_Gameboy.getRomBank() : 0;
+    return bank << 16 | pc; //NOLINT(cppcoreguidelines-avoid-magic-numbers)
+}
+
+auto Profiler::format(u32 key) -> std::string
+{
+    std::stringstream stream;
+    stream << std::uppercase << std::hex << std::setfill('0')
+           << std::setw(2) << (key >> 16) << ':' << std::setw(4) << (key & UINT16_MAX); //NOLINT(cppcoreguidelines-avoid-magic-numbers)
+    return stream.str();
+}
+
+void Profiler::writeReport() const
+{
+    std::ofstream file(m_Path);
+    if(!file)
+    {
+        ERROR("Could not write the profile to " << m_Path << "!");
+        return;
+    }
+
+    auto percent = [](u64 count, u64 total) { return total ? 100.0 * count / total : 0.0; };
+
+    file << "Samples: " << m_Samples << ", one every " << m_Interval << " cycles\n\n";
+
+    std::vector<std::pair<u32, u64>> pcs(m_PCs.begin(), m_PCs.end());
+    std::sort(pcs.begin(), pcs.end(), [](const auto& a, const auto& b) { return a.second > b.second; });
+    pcs.resize(std::min<size_t>(pcs.size(), MAX_REPORT_PCS));
+
+    file << "Hottest PCs (bank:address)\n";
+    for(const auto& [key, count] : pcs)
+    {
+        file << "    " << format(key) << std::dec << std::setfill(' ')
+             << std::setw(12) << count << std::setw(8) << std::fixed << std::setprecision(2) << percent(count, m_Samples) << "%\n";
+    }
+
+    auto writeOpcodes = [&file, &percent](const char* title, const char* prefix, const std::array<u64, 0x100>& counts)
+    {
+        u64 total = 0;
+        std::vector<std::pair<u16, u64>> opcodes;
+
+        for(u16 opcode = 0; opcode < counts.size(); ++opcode)
+        {
+            total += counts[opcode];
+            if(counts[opcode]) opcodes.emplace_back(opcode, counts[opcode]);
+        }
+
+        std::sort(opcodes.begin(), opcodes.end(), [](const auto& a, const auto& b) { return a.second > b.second; });
+
+        file << '\n' << title << " (" << std::dec << total << " executed)\n";
+        for(const auto& [opcode, count] : opcodes)
+        {
+            file << "    " << prefix << "0x" << std::uppercase << std::hex << std::setfill('0') << std::setw(2) << opcode
+                 << std::dec << std::setfill(' ') << std::setw(14) << count
+                 << std::setw(8) << std::fixed << std::setprecision(2) << percent(count, total) << "%\n";
+        }
+    };
+
+    writeOpcodes("Opcodes", "", m_Opcodes);
+    writeOpcodes("CB Opcodes", "CB ", m_OpcodesCB);
+
+    DEBUG("Wrote the profile to " << m_Path << ".");
+}
+
+void Profiler::writeFolded() const
+{
+    std::ofstream file(m_Path + ".folded");
+    if(!file)
+    {
+        ERROR("Could not write the folded stacks to " << m_Path << ".folded!");
+        return;
+    }
+
+    for(const auto& [stack, count] : m_Stacks)
+    {
+        file << stack << ' ' << count << '\n';
+    }
+
+    DEBUG("Wrote the folded stacks to " << m_Path << ".folded.");
+}
+
+#endif
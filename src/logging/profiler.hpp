@@ -0,0 +1,136 @@
+#pragma once
+
+#include "core.hpp"
+
+#include <array>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class Gameboy;
+
+/**
+ * Profiles the guest code: counts every opcode the interpreter fetches and
+ * samples (bank, PC) every so many cycles, along with the routines that were
+ * called to get there. On exit it writes a report of the hottest PCs and opcodes
+ * and a folded stacks file that flamegraph.pl and speedscope can read.
+ * 
+ * Only built with GUEST_PROFILER, otherwise the hooks below compile to nothing.
+**/
+class Profiler
+{
+    public:
+        /**
+         * @param gb The Gameboy to profile
+         * @param path The filepath of the report, the folded stacks go to path + ".folded"
+         * @param interval The number of cycles between samples
+         */
+        Profiler(Gameboy& gb, std::string path, u32 interval);
+        ~Profiler();
+
+        Profiler(const Profiler&) = delete;
+        auto operator=(const Profiler&) -> Profiler& = delete;
+
+        /**
+         * @brief Counts an opcode that was fetched
+         * 
+         * @param opcode The opcode
+         */
+        __always_inline void countOpcode(u8 opcode);
+
+        /**
+         * @brief Counts a CB prefixed opcode that was fetched
+         * 
+         * @param opcode The opcode after the prefix
+         */
+        __always_inline void countOpcodeCB(u8 opcode);
+
+        /**
+         * @brief Takes a sample for every interval that passed since the last one
+         * 
+         * @param pc The address of the instruction that just ran
+         */
+        void sample(u16 pc);
+
+        /**
+         * @brief Enters a routine through a call, RST or interrupt
+         * 
+         * @param pc The address of the routine
+         * @param sp SP after the return address was pushed
+         */
+        void call(u16 pc, u16 sp);
+
+        /**
+         * @brief Leaves every routine whose return address is no longer on the stack
+         * 
+         * @param sp SP after the return address was popped
+         */
+        void ret(u16 sp);
+    private:
+        struct Frame
+        {
+            u32 routine;    // (bank, PC) of the routine
+            u16 sp;
+        };
+
+        /**
+         * @brief Gets the (bank, PC) key of an address
+         * 
+         * @param pc The address
+         * @return The rom bank in the high half (0 outside of 0x4000 - 0x7FFF) and the address in the low half
+         */
+        [[nodiscard]] auto getKey(u16 pc) const -> u32;
+
+        /**
+         * @brief Formats a (bank, PC) key as bank:address
+         * 
+         * @param key The key
+         */
+        [[nodiscard]] static auto format(u32 key) -> std::string;
+
+        void writeReport() const;
+        void writeFolded() const;
+    private:
+        Gameboy& m_Gameboy;
+
+        std::string m_Path;
+        u32 m_Interval;
+        u64 m_NextSample;
+        u64 m_Samples;
+
+        std::array<u64, 0x100> m_Opcodes;
+        std::array<u64, 0x100> m_OpcodesCB;
+
+        std::unordered_map<u32, u64> m_PCs;
+        std::unordered_map<std::string, u64> m_Stacks;
+        std::vector<Frame> m_Frames;
+};
+
+//--------------------------  Inline function implementations --------------------------//
+
+__always_inline void Profiler::countOpcode(u8 opcode)
+{
+    m_Opcodes[opcode]++;
+}
+
+__always_inline void Profiler::countOpcodeCB(u8 opcode)
+{
+    m_OpcodesCB[opcode]++;
+}
+
+//--------------------------------------Hooks--------------------------------------//
+
+// Used from within the cpu, which only has a profiler when one was requested
+#ifdef GUEST_PROFILER
+    #define PROFILE_OPCODE(opcode)      if(m_Profiler) m_Profiler->countOpcode(opcode)                          //NOLINT(cppcoreguidelines-macro-usage)
+    #define PROFILE_OPCODE_CB(opcode)   if(m_Profiler) m_Profiler->countOpcodeCB(opcode)                        //NOLINT(cppcoreguidelines-macro-usage)
+    #define PROFILE_SAMPLE(pc)          if(m_Profiler) m_Profiler->sample(pc)                                   //NOLINT(cppcoreguidelines-macro-usage)
+    #define PROFILE_CALL()              if(m_Profiler) m_Profiler->call(m_Registers.PC(), m_Registers.SP())     //NOLINT(cppcoreguidelines-macro-usage)
+    #define PROFILE_RET()               if(m_Profiler) m_Profiler->ret(m_Registers.SP())                        //NOLINT(cppcoreguidelines-macro-usage)
+#else
+    #define PROFILE_OPCODE(opcode)      ((void)0) //NOLINT(cppcoreguidelines-macro-usage)
+    #define PROFILE_OPCODE_CB(opcode)   ((void)0) //NOLINT(cppcoreguidelines-macro-usage)
+    #define PROFILE_SAMPLE(pc)          ((void)0) //NOLINT(cppcoreguidelines-macro-usage)
+    #define PROFILE_CALL()              ((void)0) //NOLINT(cppcoreguidelines-macro-usage)
+    #define PROFILE_RET()               ((void)0) //NOLINT(cppcoreguidelines-macro-usage)
+#endif
@@ -35,6 +35,25 @@ auto main(int argc, char** argv) -> int
     u32 targetFPS = 60;
     shatter.add_option("--fps,--frame-rate", targetFPS, "Set the desired fps of the emulation. Set to 0 for unlimited.");
 
+    std::string interpreter = "table";
+    shatter.add_option("-i,--interpreter", interpreter, "The cpu interpreter to use (table, threaded, cached or jit).")
+        ->check(CLI::IsMember({"table", "threaded", "cached", "jit"}));
+
+    std::string colours = "green";
+    shatter.add_option("-c,--colours,--colour-scheme", colours, "The colours the screen is shown in (green, gray or pocket).")
+        ->check(CLI::IsMember({"green", "gray", "pocket"}));
+
+    bool dmaTiming = false;
+    shatter.add_flag("--dma-timing", dmaTiming, "Lock the cpu out of everything but HRAM while OAM DMA runs.");
+
+    #ifdef GUEST_PROFILER
+        std::string profilePath;
+        shatter.add_option("-p,--profile", profilePath, "Path to write a profile of the guest code to on exit.");
+
+        u32 profileInterval = DEFAULT_PROFILE_INTERVAL;
+        shatter.add_option("--profile-interval", profileInterval, "The number of cycles between profile samples.");
+    #endif
+
     #ifndef NDEBUG
         bool verbose = false;
         shatter.add_flag("-v,--verbose", verbose, "Enable opcode logging.");
@@ -92,6 +111,54 @@ auto main(int argc, char** argv) -> int
         gb.setRenderingScale(renderingScale);
     }
 
+    #ifdef GUEST_PROFILER
+        // Blocks run their handlers without fetching the opcodes, which would leave the histogram empty
+        if(!profilePath.empty() && (interpreter == "cached" || interpreter == "jit"))
+        {
+            WARN("The profiler needs the opcodes to be fetched, falling back to the table interpreter.");
+            interpreter = "table";
+        }
+    #endif
+
+    if(interpreter == "threaded")
+    {
+        gb.setInterpreter(Interpreter::Threaded);
+    }
+    else if(interpreter == "cached")
+    {
+        gb.setInterpreter(Interpreter::Cached);
+    }
+    else if(interpreter == "jit")
+    {
+        gb.setInterpreter(Interpreter::JIT);
+    }
+    else
+    {
+        gb.setInterpreter(Interpreter::Table);
+    }
+
+    gb.setDmaTiming(dmaTiming);
+
+    if(colours == "gray")
+    {
+        gb.setColourScheme(Colour::Scheme::Gray);
+    }
+    else if(colours == "pocket")
+    {
+        gb.setColourScheme(Colour::Scheme::Pocket);
+    }
+    else
+    {
+        gb.setColourScheme(Colour::Scheme::Green);
+    }
+
+    #ifdef GUEST_PROFILER
+        if(!profilePath.empty())
+        {
+            gb.enableProfiler(profilePath, profileInterval);
+        }
+    #endif
+
     gb.start();
 
     u64 frameStart, frameEnd, fpsStart, fpsEnd;
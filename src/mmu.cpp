@@ -4,24 +4,28 @@
 
 #include "gameboy.hpp"
 
+#include <algorithm>
 #include <fstream>
 #include <memory>
 
 MMU::MMU(Gameboy& gb)
-    : m_Gameboy(gb), m_Memory({}), m_BootRom({}), m_BootRomEnabled(false)
+    : m_Gameboy(gb), m_Memory({}), m_BootRom({}), m_BootRomEnabled(false),
+      m_DmaTiming(false), m_DmaActive(false), m_DmaEnd(0), m_CodeRegions({}),
+      m_ReadPages({}), m_WritePages({}), m_IORegisters({})
 {
     DEBUG("Initializing MMU.");
+    mapMemory();
 }
 
 void MMU::load(const std::string& path)
 {
     if(m_Cart) return;
 
-    std::vector<u8> rom = MBC::loadRom(path);
+    std::shared_ptr<const Rom> rom = MBC::loadRom(path);
     std::vector<u8> ram = MBC::loadRam(path + ".sav");
 
-    Cart::Type type   = MBC::getCartType(rom);
-    std::string title = MBC::getCartTitle(rom);
+    Cart::Type type   = MBC::getCartType(rom->getData());
+    std::string title = MBC::getCartTitle(rom->getData());
 
     m_Gameboy.setTitle("Shatter Emulator: " + title);
     DEBUG("Loaded " << title << ".");
@@ -29,19 +33,19 @@ void MMU::load(const std::string& path)
     switch(type)
     {
         case Cart::Type::ROM_ONLY:
-            m_Cart = std::make_unique<RomOnly>(std::move(rom));
+            m_Cart.emplace(std::in_place_type<RomOnly>, std::move(rom));
             break;
         case Cart::Type::MBC1:
         case Cart::Type::MBC1_RAM:
         case Cart::Type::MBC1_RAM_BATTERY:
-            m_Cart = std::make_unique<MBC1>(std::move(rom), std::move(ram));
+            m_Cart.emplace(std::in_place_type<MBC1>, std::move(rom), std::move(ram));
             break;
         case Cart::Type::MBC3_TIMER_BATTERY:
         case Cart::Type::MBC3_TIMER_RAM_BATTERY_2:
         case Cart::Type::MBC3:
         case Cart::Type::MBC3_RAM_2:
         case Cart::Type::MBC3_RAM_BATTERY_2:
-            m_Cart = std::make_unique<MBC3>(std::move(rom), std::move(ram));
+            m_Cart.emplace(std::in_place_type<MBC3>, std::move(rom), std::move(ram));
             break;
         case Cart::Type::MBC5:
         case Cart::Type::MBC5_RAM:
@@ -49,11 +53,13 @@ void MMU::load(const std::string& path)
         case Cart::Type::MBC5_RUMBLE:
         case Cart::Type::MBC5_RUMBLE_RAM:
         case Cart::Type::MBC5_RUMBLE_RAM_BATTERY:
-            m_Cart = std::make_unique<MBC5>(std::move(rom), std::move(ram));
+            m_Cart.emplace(std::in_place_type<MBC5>, std::move(rom), std::move(ram));
             break;
         default:
-            m_Cart = std::make_unique<RomOnly>(std::move(rom));
+            m_Cart.emplace(std::in_place_type<RomOnly>, std::move(rom));
     }
+
+    mapRom();
 }
 
 void MMU::loadBoot(const std::string& path)
@@ -62,11 +68,12 @@ void MMU::loadBoot(const std::string& path)
     std::ifstream data(path, std::ios::in | std::ios::binary);
     data.read(reinterpret_cast<char*>(&m_BootRom[0]), BOOT_ROM_SIZE);
     m_BootRomEnabled = true;
+    mapRom();
 }
 
 void MMU::save(const std::string& path)
 {
-    auto& ram = m_Cart->getRam();
+    const auto& ram = getCart().getRam();
 
     if(ram.empty())
     {
@@ -79,8 +86,14 @@ void MMU::save(const std::string& path)
     DEBUG("Saved data to: " << path << ".sav.");
 }
 
-auto MMU::read(u16 address) const -> u8
+auto MMU::readHandler(u16 address) const -> u8
 {
+    // Only the cpu is locked out during OAM DMA, not the components
+    if(m_DmaActive && address < HRAM_START_ADDR && !m_Gameboy.isSyncing())
+    {
+        return UINT8_MAX;
+    }
+
     if(address < ROM_END_ADDR)
     {
         if(address < BOOT_ROM_SIZE && m_BootRomEnabled)
@@ -88,7 +101,7 @@ auto MMU::read(u16 address) const -> u8
             return m_BootRom[address];
         }
 
-        return m_Cart->read(address);
+        return readCart(address);
     }
     else if(address < VRAM_END_ADDR)
     {
@@ -96,7 +109,7 @@ auto MMU::read(u16 address) const -> u8
     }
     else if(address < RAM_BANK_END_ADDR)
     {
-        return m_Cart->read(address);
+        return readCart(address);
     }
     else if(address < INTERNAL_RAM_END_ADDR)
     {
@@ -116,45 +129,55 @@ auto MMU::read(u16 address) const -> u8
     }
     else if(address < IO_END_ADDR)
     {
-        switch(address)
-        {
-            case JOYPAD_REGISTER:
-                return m_Gameboy.getInput();
-            case TIMER_DIV_REGISTER:
-                return m_Gameboy.getDIV();
-            case BOOT_REGISTER:
-                return m_BootRomEnabled ? 0 : 1;
-            default:
-                return m_Memory[address - ROM_SIZE];
-        }
+        const IORegister& reg = m_IORegisters[address - IO_START_ADDR];
+        return reg.read ? reg.read(m_Gameboy) : m_Memory[address - ROM_SIZE];
     }
-    else
+    else if(address < HRAM_END_ADDR)
     {
         return m_Memory[address - ROM_SIZE];
     }
+    else
+    {
+        return m_Gameboy.getIE();
+    }
 }
 
-void MMU::write(u16 address, u8 val)
+void MMU::writeHandler(u16 address, u8 val)
 {
+    if(m_DmaActive && address < HRAM_START_ADDR && !m_Gameboy.isSyncing())
+    {
+        return;
+    }
+
     if(address < ROM_END_ADDR)
     {
-        m_Cart->write(address, val);
+        u16 bank = getRomBank();
+        writeCart(address, val);
+
+        if(getRomBank() != bank)
+        {
+            mapRom();
+            m_Gameboy.switchedBank();
+        }
     }
     else if(address < VRAM_END_ADDR)
     {
         m_Memory[address - ROM_SIZE] = val;
+        if(address < TILE_DATA_END) updateTiles(address, 1);
     }
     else if(address < RAM_BANK_END_ADDR)
     {
-        m_Cart->write(address, val);
+        writeCart(address, val);
     }
     else if(address < INTERNAL_RAM_END_ADDR)
     {
         m_Memory[address - ROM_SIZE] = val;
+        invalidateCode(address);
     }
     else if(address < ECHO_RAM_END_ADDR)
     {
         m_Memory[address - ROM_SIZE - INTERNAL_RAM_SIZE] = val; // Map back into RAM
+        invalidateCode(address - INTERNAL_RAM_SIZE);
     }
     else if(address < OAM_END_ADDR)
     {
@@ -166,47 +189,94 @@ void MMU::write(u16 address, u8 val)
     }
     else if(address < IO_END_ADDR)
     {
-        switch(address)
-        {
-            case JOYPAD_REGISTER:
-                m_Gameboy.setInput(val);
-                break;
-            case TIMER_DIV_REGISTER:
-                m_Gameboy.resetDiv();
-                break;
-            case TIMER_TAC_REGISTER:
-                m_Memory[address - ROM_SIZE] = val;
-                switch(val & 0b11)
-                {
-                    case 0b00:
-                        m_Gameboy.setTimerSpeed(TIMER_SPEED_00);
-                        break;
-                    case 0b01:
-                        m_Gameboy.setTimerSpeed(TIMER_SPEED_01);
-                        break;
-                    case 0b10:
-                        m_Gameboy.setTimerSpeed(TIMER_SPEED_10);
-                        break;
-                    case 0b11:
-                        m_Gameboy.setTimerSpeed(TIMER_SPEED_11);
-                        break;
-                    default:
-                        ASSERT(false, "Timer Speed Switch branched to invalid case!");
-                }
-                break;
-            case DMA_TRANSFER_REGISTER:
-                dmaTransfer(val);
-                break;
-            case BOOT_REGISTER:
-                m_BootRomEnabled = (val == 0);
-                break;
-            default:
-                m_Memory[address - ROM_SIZE] = val;
-        }
+        const IORegister& reg = m_IORegisters[address - IO_START_ADDR];
+
+        // The components have to see every cycle before the write with the old value
+        if(reg.sync) m_Gameboy.syncComponents();
+
+        // Read only bits are only protected from the cpu, the components update them
+        u8 mask = m_Gameboy.isSyncing() ? UINT8_MAX : reg.writeMask;
+        u8& stored = m_Memory[address - ROM_SIZE];
+        stored = (stored & ~mask) | (val & mask);
+
+        if(reg.write) reg.write(m_Gameboy, val);
+
+        if(reg.sync) m_Gameboy.scheduleSync();
     }
-    else
+    else if(address < HRAM_END_ADDR)
     {
         m_Memory[address - ROM_SIZE] = val;
+        invalidateCode(address);
+    }
+    else
+    {
+        m_Gameboy.setIE(val);
+    }
+}
+
+void MMU::mapMemory()
+{
+    // Writes to tile data go through the handler, which keeps the PPU's tile cache up to date
+    for(u32 address = VRAM_START_ADDR; address < VRAM_END_ADDR; address += MEMORY_PAGE_SIZE)
+    {
+        m_ReadPages[address / MEMORY_PAGE_SIZE]  = &m_Memory[address - ROM_SIZE];
+        m_WritePages[address / MEMORY_PAGE_SIZE] = (address < TILE_DATA_END) ? nullptr : &m_Memory[address - ROM_SIZE];
+    }
+
+    for(u32 address = INTERNAL_RAM_START_ADDR; address < ECHO_RAM_END_ADDR; address += MEMORY_PAGE_SIZE)
+    {
+        u32 offset = (address < INTERNAL_RAM_END_ADDR) ? ROM_SIZE : ROM_SIZE + INTERNAL_RAM_SIZE; // Echo maps back into RAM
+        m_ReadPages[address / MEMORY_PAGE_SIZE] = &m_Memory[address - offset];
+    }
+
+    for(u32 address = INTERNAL_RAM_START_ADDR; address < INTERNAL_RAM_END_ADDR; address += MEMORY_PAGE_SIZE)
+    {
+        mapRam(address);
+    }
+}
+
+void MMU::mapRom()
+{
+    if(m_DmaActive) return; // Mapped again once the transfer is done
+
+    static_assert(BOOT_ROM_SIZE == MEMORY_PAGE_SIZE, "The bootrom has to fill exactly one page!");
+
+    constexpr u32 BANK_PAGES = ROM_BANK_SIZE / MEMORY_PAGE_SIZE;
+
+    // Banks that don't exist are left to the MBC to handle
+    const u8* bank0 = m_Cart ? getCart().getRomData(0) : nullptr;
+    const u8* bankN = m_Cart ? getCart().getRomData(getRomBank()) : nullptr;
+
+    for(u32 page = 0; page < BANK_PAGES; ++page)
+    {
+        m_ReadPages[page]              = bank0 ? bank0 + page * MEMORY_PAGE_SIZE : nullptr;
+        m_ReadPages[page + BANK_PAGES] = bankN ? bankN + page * MEMORY_PAGE_SIZE : nullptr;
+    }
+
+    if(m_BootRomEnabled)
+    {
+        m_ReadPages[0] = m_BootRom.data();
+    }
+}
+
+void MMU::mapRam(u16 address)
+{
+    if(m_DmaActive) return;
+
+    u16 start = address - address % MEMORY_PAGE_SIZE;
+
+    bool code = false;
+    for(u16 region = start / CODE_REGION_SIZE; region < (start + MEMORY_PAGE_SIZE) / CODE_REGION_SIZE; ++region)
+    {
+        code |= m_CodeRegions[region];
+    }
+
+    u8* page = code ? nullptr : &m_Memory[start - ROM_SIZE];
+    m_WritePages[start / MEMORY_PAGE_SIZE] = page;
+
+    if(start + INTERNAL_RAM_SIZE < ECHO_RAM_END_ADDR)
+    {
+        m_WritePages[(start + INTERNAL_RAM_SIZE) / MEMORY_PAGE_SIZE] = page;
     }
 }
 
@@ -215,11 +285,158 @@ auto MMU::isBootEnabled() const -> bool
     return m_BootRomEnabled;
 }
 
+auto MMU::getRomBank() const -> u16
+{
+    return getCart().getRomBank();
+}
+
+void MMU::setBootEnabled(bool enabled)
+{
+    m_BootRomEnabled = enabled;
+    mapRom();
+}
+
+void MMU::mapIO(u16 address, IORegister reg)
+{
+    m_IORegisters[address - IO_START_ADDR] = reg;
+}
+
+void MMU::setDmaTiming(bool timed)
+{
+    m_DmaTiming = timed;
+}
+
+void MMU::updateDma(u64 now)
+{
+    if(!m_DmaActive || now < m_DmaEnd) return;
+
+    m_DmaActive = false;
+    mapMemory();
+    mapRom();
+}
+
+auto MMU::getDmaEnd() const -> u64
+{
+    return m_DmaActive ? m_DmaEnd : UINT64_MAX;
+}
+
+void MMU::markCode(u16 address)
+{
+    m_CodeRegions[address / CODE_REGION_SIZE] = true;
+
+    // Writes to the page have to go through the handler now, so they invalidate the code
+    if(INTERNAL_RAM_START_ADDR <= address && address < INTERNAL_RAM_END_ADDR)
+    {
+        mapRam(address);
+    }
+}
+
+__always_inline void MMU::invalidateCode(u16 address)
+{
+    if(m_CodeRegions[address / CODE_REGION_SIZE])
+    {
+        m_CodeRegions[address / CODE_REGION_SIZE] = false;
+        if(INTERNAL_RAM_START_ADDR <= address && address < INTERNAL_RAM_END_ADDR)
+        {
+            mapRam(address);
+        }
+
+        m_Gameboy.invalidateCode(address);
+    }
+}
+
+auto MMU::copy(u16 dst, u16 src, u16 length) -> bool
+{
+    if(!isPlain(src, length, false) || !isPlain(dst, length, true)) return false;
+
+    // The blocks may overlap, so copy one byte at a time like the cpu would
+    for(u16 i = 0; i < length; ++i)
+    {
+        m_Memory[dst - ROM_SIZE + i] = read(src + i);
+    }
+
+    updateTiles(dst, length);
+    invalidateCode(dst, length);
+    return true;
+}
+
+auto MMU::fill(u16 dst, u8 val, u16 length) -> bool
+{
+    if(!isPlain(dst, length, true)) return false;
+
+    std::fill_n(m_Memory.begin() + (dst - ROM_SIZE), length, val);
+
+    updateTiles(dst, length);
+    invalidateCode(dst, length);
+    return true;
+}
+
+auto MMU::isPlain(u16 address, u16 length, bool write) const -> bool
+{
+    if(m_DmaActive) return false;
+
+    u32 end = address + length;
+    auto within = [address, end](u32 start, u32 stop) { return start <= address && end <= stop; };
+
+    if(within(VRAM_START_ADDR, VRAM_END_ADDR) || within(INTERNAL_RAM_START_ADDR, INTERNAL_RAM_END_ADDR)
+    || within(HRAM_START_ADDR, HRAM_END_ADDR))
+    {
+        return true;
+    }
+
+    // Either rom bank can be read, as long as the block doesn't run into the bootrom or the other bank
+    return !write && (within(m_BootRomEnabled ? BOOT_ROM_SIZE : ROM_START_ADDR, ROM_BANK_SIZE)
+                   || within(ROM_BANK_SIZE, ROM_END_ADDR));
+}
+
+void MMU::updateTiles(u16 address, u16 length)
+{
+    u32 start = std::max<u32>(address, TILE_DATA_HIGH) & ~1U; // Rows start at even addresses
+    u32 end   = std::min<u32>(address + length, TILE_DATA_END);
+
+    for(u32 row = start; row < end; row += 2)
+    {
+        m_Gameboy.updateTile(row, m_Memory[row - ROM_SIZE], m_Memory[row + 1 - ROM_SIZE]);
+    }
+}
+
+void MMU::invalidateCode(u16 address, u16 length)
+{
+    if(address < INTERNAL_RAM_START_ADDR) return; // Code isn't cached from vram
+
+    for(u32 region = address / CODE_REGION_SIZE; region <= (address + length - 1U) / CODE_REGION_SIZE; ++region)
+    {
+        invalidateCode(static_cast<u16>(region * CODE_REGION_SIZE));
+    }
+}
+
 void MMU::dmaTransfer(u8 val)
 {
-    u16 address = val * 0x100;
-    for (u8 i = 0; i < DMA_TRANSFER_SIZE; ++i)
+    u8* oam = &m_Memory[OAM_START_ADDR - ROM_SIZE];
+
+    // The source never crosses a page, so its page table entry covers all of it
+    const u8* page = m_ReadPages[val];
+    if(page)
     {
-        write(OAM_START_ADDR + i, read(address + i));
+        std::copy_n(page, DMA_TRANSFER_SIZE, oam);
+    }
+    else
+    {
+        u16 address = val * MEMORY_PAGE_SIZE;
+        for(u8 i = 0; i < DMA_TRANSFER_SIZE; ++i)
+        {
+            oam[i] = read(address + i);
+        }
+    }
+
+    if(m_DmaTiming)
+    {
+        // OAM is filled right away, but the cpu is locked out of everything but HRAM until the transfer would be done
+        m_DmaActive = true;
+        m_DmaEnd    = m_Gameboy.getTimestamp() + DMA_TRANSFER_CYCLES;
+        m_ReadPages.fill(nullptr);
+        m_WritePages.fill(nullptr);
+
+        m_Gameboy.scheduleSync(); // Schedules the end of the transfer
     }
 }
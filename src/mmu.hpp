@@ -3,7 +3,8 @@
 #include "core.hpp"
 
 #include <array>
-#include <memory>
+#include <optional>
+#include <variant>
 
 #include "cart/romonly.hpp"
 #include "cart/mbc1.hpp"
@@ -12,6 +13,24 @@
 
 class Gameboy;
 
+/**
+ * How the MMU handles an IO register. Writes are stored in memory first, then
+ * passed on to the component, and reads without a handler come from memory.
+**/
+struct IORegister
+{
+    using Reader = auto (*)(Gameboy& gb) -> u8;
+    using Writer = void (*)(Gameboy& gb, u8 val);
+
+    Reader read  = nullptr;
+    Writer write = nullptr;
+
+    u8 writeMask = UINT8_MAX;   // The bits the cpu can write, the others are read only
+    bool sync    = false;       // If writing changes how the timer or PPU step, or gets overwritten the next time they do
+};
+
+using Cartridge = std::variant<RomOnly, MBC1, MBC3, MBC5>;
+
 class MMU
 {
     public:
@@ -44,7 +63,7 @@ class MMU
          * @param address The address to read from
          * @return The value stored at that address
          */
-        [[nodiscard]] auto read(u16 address) const -> u8;
+        [[nodiscard]] __always_inline auto read(u16 address) const -> u8;
 
         /**
          * @brief Writes a byte at the specified memory address
@@ -52,7 +71,7 @@ class MMU
          * @param address The address to write to
          * @param val The value to write
          */
-        void write(u16 address, u8 val);
+        __always_inline void write(u16 address, u8 val);
 
         /**
          * @brief Returns if the bootrom is enabled
@@ -60,19 +79,239 @@ class MMU
          * @return The status of if the bootrom is enabled
          */
         [[nodiscard]] auto isBootEnabled() const -> bool;
-    private:
+
+        /**
+         * @brief Gets the rom bank currently mapped to 0x4000 - 0x7FFF
+         * 
+         * @return The current rom bank
+         */
+        [[nodiscard]] auto getRomBank() const -> u16;
+
+        /**
+         * @brief Enables or disables the bootrom, mapping it over the start of the rom
+         * 
+         * @param enabled If the bootrom is enabled
+         */
+        void setBootEnabled(bool enabled);
+
+        /**
+         * @brief Sets how an IO register is handled
+         * 
+         * @param address The address of the register
+         * @param reg The handlers and masks of the register
+         */
+        void mapIO(u16 address, IORegister reg);
+
         /**
-         * @brief Initiates the DMA transfer
+         * @brief Copies a page into OAM, in one go if it is plain memory
          * 
-         * @param val The value given to the dma transfer
+         * @param val The value given to the dma transfer, the high byte of the page
          */
         void dmaTransfer(u8 val);
+
+        /**
+         * @brief Sets if OAM DMA takes its 640 cycles, during which the cpu can only access HRAM,
+         * instead of being instant
+         * 
+         * @param timed If transfers are timed
+         */
+        void setDmaTiming(bool timed);
+
+        /**
+         * @brief Ends a timed OAM DMA transfer if its cycles have passed
+         * 
+         * @param now The master cycle count
+         */
+        void updateDma(u64 now);
+
+        /**
+         * @brief Gets when the current OAM DMA transfer ends
+         * 
+         * @return The master cycle count it ends at, or UINT64_MAX if there is none
+         */
+        [[nodiscard]] auto getDmaEnd() const -> u64;
+
+        /**
+         * @brief Marks the region of ram containing an address as holding
+         * cached code, so that the next write to it invalidates the code
+         * 
+         * @param address The address in ram
+         */
+        void markCode(u16 address);
+
+        /**
+         * @brief Copies a block of memory byte by byte like the cpu would, without
+         * going through MMU::write for every byte. Both blocks have to lie within
+         * a single region of plain memory, no IO registers and no bank boundaries
+         * 
+         * @param dst The address to copy to
+         * @param src The address to copy from
+         * @param length The number of bytes to copy
+         * @return If the block could be copied, nothing is copied otherwise
+         */
+        auto copy(u16 dst, u16 src, u16 length) -> bool;
+
+        /**
+         * @brief Fills a block of memory with a value, without going through
+         * MMU::write for every byte. The block has to lie within a single
+         * region of plain memory, no IO registers and no bank boundaries
+         * 
+         * @param dst The address to fill from
+         * @param val The value to fill with
+         * @param length The number of bytes to fill
+         * @return If the block could be filled, nothing is filled otherwise
+         */
+        auto fill(u16 dst, u8 val, u16 length) -> bool;
+    private:
+        /**
+         * @brief Reads a byte from the cartridge
+         * 
+         * @param address The address to read from
+         * @return The value stored at that address
+         */
+        [[nodiscard]] __always_inline auto readCart(u16 address) const -> u8;
+
+        /**
+         * @brief Writes a byte to the cartridge
+         * 
+         * @param address The address to write to
+         * @param val The value to write
+         */
+        __always_inline void writeCart(u16 address, u8 val);
+
+        /**
+         * @brief Gets the state all cartridges share
+         * 
+         * @return The cartridge as its base class
+         */
+        [[nodiscard]] __always_inline auto getCart() const -> const MBC&;
+
+        /**
+         * @brief Reads a byte from an address that isn't mapped in the page table
+         * 
+         * @param address The address to read from
+         * @return The value stored at that address
+         */
+        [[nodiscard]] auto readHandler(u16 address) const -> u8;
+
+        /**
+         * @brief Writes a byte to an address that isn't mapped in the page table
+         * 
+         * @param address The address to write to
+         * @param val The value to write
+         */
+        void writeHandler(u16 address, u8 val);
+
+        /**
+         * @brief Points the pages of vram, internal ram and echo ram at memory
+         * 
+         */
+        void mapMemory();
+
+        /**
+         * @brief Points the pages of both rom banks at the current banks (and
+         * the first page at the bootrom while it is enabled)
+         * 
+         */
+        void mapRom();
+
+        /**
+         * @brief Points the write pages of a page of internal ram and its echo at
+         * memory, unless the page holds cached code which writes have to invalidate
+         * 
+         * @param address An address in the page
+         */
+        void mapRam(u16 address);
+
+        /**
+         * @brief Checks if a block of memory lies within a single region
+         * that can be read or written without side effects
+         * 
+         * @param address The start of the block
+         * @param length The length of the block
+         * @param write If the block is going to be written to
+         * @return If the block is plain memory
+         */
+        [[nodiscard]] auto isPlain(u16 address, u16 length, bool write) const -> bool;
+
+        /**
+         * @brief Decodes the rows of the tiles in a block of vram that was written to
+         * 
+         * @param address The start of the block
+         * @param length The length of the block
+         */
+        void updateTiles(u16 address, u16 length);
+
+        /**
+         * @brief Invalidates any cached code in a block of ram that was written to
+         * 
+         * @param address The start of the block
+         * @param length The length of the block
+         */
+        void invalidateCode(u16 address, u16 length);
+
+        /**
+         * @brief Invalidates any cached code in the region of ram
+         * containing an address if it was marked
+         * 
+         * @param address The address that was written to
+         */
+        void invalidateCode(u16 address);
     private:
         Gameboy& m_Gameboy;
         
-        std::unique_ptr<MBC> m_Cart;
+        std::optional<Cartridge> m_Cart; // Resolved to one MBC once on load
         std::array<u8, RAM_SIZE> m_Memory;
 
         std::array<u8, BOOT_ROM_SIZE> m_BootRom;
         bool m_BootRomEnabled;
+
+        bool m_DmaTiming;
+        bool m_DmaActive;   // The page table is empty while the cpu can only access HRAM
+        u64 m_DmaEnd;
+
+        std::array<bool, (UINT16_MAX + 1) / CODE_REGION_SIZE> m_CodeRegions;
+
+        // The memory behind every page of the address space, or nullptr if accessing it has side effects
+        std::array<const u8*, MEMORY_PAGE_COUNT> m_ReadPages;
+        std::array<u8*, MEMORY_PAGE_COUNT> m_WritePages;
+
+        std::array<IORegister, IO_REGISTER_COUNT> m_IORegisters;
 };
+
+//--------------------------  Inline function implementations --------------------------//
+
+__always_inline auto MMU::read(u16 address) const -> u8
+{
+    const u8* page = m_ReadPages[address / MEMORY_PAGE_SIZE];
+    if(page) return page[address % MEMORY_PAGE_SIZE];
+
+    return readHandler(address);
+}
+
+__always_inline auto MMU::readCart(u16 address) const -> u8
+{
+    return std::visit([address](const auto& cart) { return cart.read(address); }, *m_Cart);
+}
+
+__always_inline void MMU::writeCart(u16 address, u8 val)
+{
+    std::visit([address, val](auto& cart) { cart.write(address, val); }, *m_Cart);
+}
+
+__always_inline auto MMU::getCart() const -> const MBC&
+{
+    return std::visit([](const auto& cart) -> const MBC& { return cart; }, *m_Cart);
+}
+
+__always_inline void MMU::write(u16 address, u8 val)
+{
+    u8* page = m_WritePages[address / MEMORY_PAGE_SIZE];
+    if(page)
+    {
+        page[address % MEMORY_PAGE_SIZE] = val;
+        return;
+    }
+
+    writeHandler(address, val);
+}
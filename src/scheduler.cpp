@@ -0,0 +1,17 @@
+#include "core.hpp"
+
+#include "scheduler.hpp"
+
+#include <algorithm>
+
+Scheduler::Scheduler()
+    : m_Timestamp(0), m_NextEvent(0), m_Events({})
+{
+    DEBUG("Initializing Scheduler.");
+}
+
+void Scheduler::schedule(Event event, u64 timestamp)
+{
+    m_Events[static_cast<u8>(event)] = timestamp;
+    m_NextEvent = *std::min_element(m_Events.begin(), m_Events.end());
+}
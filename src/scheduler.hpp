@@ -0,0 +1,84 @@
+#pragma once
+
+#include "core.hpp"
+
+#include <array>
+
+/**
+ * Keeps the master cycle count, which never wraps, and the cycle each
+ * component next has to be stepped at. The cpu runs freely until the
+ * earliest of these is reached, instead of every component being stepped
+ * after every instruction.
+ * 
+ * DIV and TIMA increments aren't events, the timer is caught up whenever
+ * they are read instead.
+**/
+class Scheduler
+{
+    public:
+        enum class Event : u8
+        {
+            PPU,    // The next mode or line change
+            Timer,  // TIMA overflowing
+            Sync,   // A component register was written, so they have to be stepped right after the instruction
+            DMA,    // The end of a timed OAM DMA transfer
+            Count
+        };
+
+        static constexpr u64 NEVER = UINT64_MAX;
+    public:
+        Scheduler();
+
+        /**
+         * @brief Moves the master cycle count forward
+         * 
+         * @param cycles The number of cycles that have passed
+         * @return If an event is due
+         */
+        __always_inline auto advance(u32 cycles) -> bool;
+
+        /**
+         * @brief Gets the master cycle count
+         * 
+         * @return The number of cycles emulated since startup
+         */
+        [[nodiscard]] __always_inline auto getTimestamp() const -> u64;
+
+        /**
+         * @brief Gets the number of cycles until the earliest event
+         * 
+         * @return The number of cycles, 0 if an event is due
+         */
+        [[nodiscard]] __always_inline auto getCyclesUntilEvent() const -> u64;
+
+        /**
+         * @brief Sets when an event next happens, replacing the previous time
+         * 
+         * @param event The event
+         * @param timestamp The master cycle count the event happens at, or NEVER
+         */
+        void schedule(Event event, u64 timestamp);
+    private:
+        u64 m_Timestamp;
+        u64 m_NextEvent;
+
+        std::array<u64, static_cast<u8>(Event::Count)> m_Events;
+};
+
+//--------------------------  Inline function implementations --------------------------//
+
+__always_inline auto Scheduler::advance(u32 cycles) -> bool
+{
+    m_Timestamp += cycles;
+    return m_Timestamp >= m_NextEvent;
+}
+
+__always_inline auto Scheduler::getTimestamp() const -> u64
+{
+    return m_Timestamp;
+}
+
+__always_inline auto Scheduler::getCyclesUntilEvent() const -> u64
+{
+    return m_NextEvent > m_Timestamp ? m_NextEvent - m_Timestamp : 0;
+}
@@ -6,15 +6,52 @@
 #include "gameboy.hpp"
 #include "video/video_defs.hpp"
 
+// The host colours of each scheme, from white to black
+constexpr std::array<std::array<Colour::ScreenColour, 4>, 3> SCHEMES
+{{
+    {{ { 0x9B, 0xBC, 0x0F, 0xFF }, { 0x8B, 0xAC, 0x0F, 0xFF }, { 0x30, 0x62, 0x30, 0xFF }, { 0x0F, 0x38, 0x0F, 0xFF } }}, // Green
+    {{ { 0xFF, 0xFF, 0xFF, 0xFF }, { 0xAA, 0xAA, 0xAA, 0xFF }, { 0x55, 0x55, 0x55, 0xFF }, { 0x00, 0x00, 0x00, 0xFF } }}, // Gray
+    {{ { 0xC4, 0xCF, 0xA1, 0xFF }, { 0x8B, 0x95, 0x6D, 0xFF }, { 0x4D, 0x53, 0x3C, 0xFF }, { 0x1F, 0x1F, 0x1F, 0xFF } }}  // Pocket
+}};
+
 PPU::PPU(Gameboy& gb)
-    : m_Gameboy(gb), m_Mode(VideoMode::OAM_Scan), m_Cycles(0), m_Line(0)
+    : m_Gameboy(gb), m_Scheme({}), m_PaletteValues({}), m_Palettes({}),
+      m_DrawIndex(0), m_FrameIndex(FRAME_BUFFER_COUNT - 1), m_FrameCount(0),
+      m_Mode(VideoMode::OAM_Scan), m_Cycles(0), m_Line(0)
 {
     DEBUG("Initializing GPU.");
+    setColourScheme(Colour::Scheme::Green);
 }
 
-void PPU::setDrawCallback(std::function<void(std::array<u8, FRAME_BUFFER_SIZE> buffer)> callback)
+void PPU::setDrawCallback(std::function<void(Frame frame)> callback)
 {
-    m_DrawCallback = callback;
+    m_DrawCallback = std::move(callback);
+}
+
+void PPU::setPalette(Colour::Palette palette, u8 value)
+{
+    m_PaletteValues[static_cast<u8>(palette)] = value;
+
+    // Each pair of bits picks the shade of a colour, starting with white in the lowest
+    Colour::PaletteTable& table = m_Palettes[static_cast<u8>(palette)];
+    for(u8 colour = 0; colour < table.size(); ++colour)
+    {
+        table[colour] = m_Scheme[(value >> (2 * colour)) & 0b11];
+    }
+}
+
+void PPU::setColourScheme(Colour::Scheme scheme)
+{
+    const auto& colours = SCHEMES[static_cast<u8>(scheme)];
+    for(u8 shade = 0; shade < m_Scheme.size(); ++shade)
+    {
+        m_Scheme[shade] = Colour::toPixel(colours[shade]);
+    }
+
+    for(u8 palette = 0; palette < m_Palettes.size(); ++palette)
+    {
+        setPalette(static_cast<Colour::Palette>(palette), m_PaletteValues[palette]);
+    }
 }
 
 void PPU::tick(u8 cycles)
@@ -86,7 +123,12 @@ void PPU::tick(u8 cycles)
                 {
                     m_Mode = VideoMode::OAM_Scan;
 
-                    std::invoke(m_DrawCallback, m_FrameBuffer);
+                    // Publish the completed frame and move on to the next buffer in the ring
+                    m_FrameIndex = m_DrawIndex;
+                    m_DrawIndex  = (m_DrawIndex + 1) % FRAME_BUFFER_COUNT;
+                    m_FrameCount++;
+
+                    if(m_DrawCallback) std::invoke(m_DrawCallback, getFrame());
                     m_Line = 0;
                     
                     u8 stat = m_Gameboy.read(LCD_STAT_REGISTER);
@@ -165,6 +207,36 @@ auto PPU::getMode() const -> VideoMode
     return m_Mode;
 }
 
+auto PPU::getCyclesUntilEvent() const -> u32
+{
+    if(!bit_functions::get_bit(m_Gameboy.read(LCD_CONTROL_REGISTER), 7))
+    {
+        return UINT32_MAX;
+    }
+
+    u16 length = 0;
+
+    switch(m_Mode)
+    {
+        case VideoMode::HBlank:
+            length = CYCLES_PER_HBLANK;
+            break;
+        case VideoMode::VBlank:
+            length = CYCLES_PER_LINE;
+            break;
+        case VideoMode::OAM_Scan:
+            length = CYCLES_PER_OAM_SCAN;
+            break;
+        case VideoMode::Transfer:
+            length = CYCLES_PER_TRANSFER;
+            break;
+        default:
+            ASSERT(false, "Invalid PPU Mode!");
+    }
+
+    return m_Cycles < length ? length - m_Cycles : 0;
+}
+
 void PPU::drawBackgroundLine(u8 line)
 {
     u8 lcdc = m_Gameboy.read(LCD_CONTROL_REGISTER);
@@ -175,39 +247,7 @@ void PPU::drawBackgroundLine(u8 line)
     u16 tileMapAddress  = bit_functions::get_bit(lcdc, 3) ? TILE_MAP_HIGH  : TILE_MAP_LOW;
     u16 tileDataAddress = bit_functions::get_bit(lcdc, 4) ? TILE_DATA_HIGH : TILE_DATA_LOW;
 
-    for(u8 col = 0; col < SCREEN_WIDTH; ++col)
-    {
-        // get the x and y position in the background
-        u8 xPos = col  + scrollX;
-        u8 yPos = line + scrollY;
-
-        // get the x and y position of the tile within the background
-        u8 tileXPos = xPos / TILE_WIDTH;
-        u8 tileYPos = yPos / TILE_HEIGHT;
-
-        // get the x and y position of the pixel within the tile
-        u8 pixelXPos = xPos % TILE_WIDTH;
-        u8 pixelYPos = yPos % TILE_HEIGHT;
-
-        // get the tile index number and the tile within the tile map
-        u16 tileIndex = tileXPos + tileYPos * TILES_PER_LINE;
-        u8  tileID    = m_Gameboy.read(tileMapAddress + tileIndex);
-
-        // get the memory offset of the tile in the tile data
-        // if we're using tile data one we need treat the offset as signed from 128
-        u16 tileDataOffset = (tileDataAddress == TILE_DATA_HIGH)
-                           ? (tileID                                   ) * BYTES_PER_TILE
-                           : (static_cast<i8>(tileID) + TILE_ONE_OFFSET) * BYTES_PER_TILE;
-
-        // add 2 bytes/line based on the y offset into the tile
-        u16 tileAddress = tileDataAddress + tileDataOffset + 2 * pixelYPos;
-
-        u8 low  = m_Gameboy.read(tileAddress    );
-        u8 high = m_Gameboy.read(tileAddress + 1);
-
-        Colour::GBColour c = getGBColour(pixelXPos, tileAddress);
-        drawPixel(col, line, c);
-    }
+    drawTileMapLine(line, tileMapAddress, tileDataAddress, scrollX, scrollY);
 }
 
 void PPU::drawWindowLine(u8 line)
@@ -236,23 +276,26 @@ void PPU::drawWindowLine(u8 line)
     u16 tileDataAddress = bit_functions::get_bit(lcdc, 4) ? TILE_DATA_HIGH : TILE_DATA_LOW;
     u16 tileMapAddress  = bit_functions::get_bit(lcdc, 6) ? TILE_MAP_HIGH  : TILE_MAP_LOW;
 
-    for(u8 col = 0; col < SCREEN_WIDTH; ++col)
-    {
-        // get the x and y position in the background
-        u8 xPos = col  + windowX;
-        u8 yPos = line + windowY;
+    drawTileMapLine(line, tileMapAddress, tileDataAddress, windowX, windowY);
+}
 
-        // get the x and y position of the tile within the background
-        u8 tileXPos = xPos / TILE_WIDTH;
-        u8 tileYPos = yPos / TILE_HEIGHT;
+void PPU::drawTileMapLine(u8 line, u16 tileMapAddress, u16 tileDataAddress, u8 scrollX, u8 scrollY)
+{
+    // get the y position in the tile map, and of the row within the tiles
+    u8 yPos      = line + scrollY;
+    u8 pixelYPos = yPos % TILE_HEIGHT;
 
-        // get the x and y position of the pixel within the tile
-        u8 pixelXPos = xPos % TILE_WIDTH;
-        u8 pixelYPos = yPos % TILE_HEIGHT;
+    u16 tileMapRow = tileMapAddress + (yPos / TILE_HEIGHT) * TILES_PER_LINE;
 
-        // get the tile index number and the tile within the tile map
-        u16 tileIndex = tileXPos + tileYPos * TILES_PER_LINE;
-        u8  tileID    = m_Gameboy.read(tileMapAddress + tileIndex);
+    const Colour::PaletteTable& palette = m_Palettes[static_cast<u8>(Colour::Palette::Background)];
+
+    // The x position in the tile map wraps around, and the first tile may be partially off screen
+    u8 xPos = scrollX;
+    u8 col  = 0;
+
+    while(col < SCREEN_WIDTH)
+    {
+        u8 tileID = m_Gameboy.read(tileMapRow + xPos / TILE_WIDTH);
 
         // get the memory offset of the tile in the tile data
         // if we're using tile data one we need treat the offset as signed from 128
@@ -261,10 +304,13 @@ void PPU::drawWindowLine(u8 line)
                            : (static_cast<i8>(tileID) + TILE_ONE_OFFSET) * BYTES_PER_TILE;
 
         // add 2 bytes/line based on the y offset into the tile
-        u16 tileAddress = tileDataAddress + tileDataOffset + 2 * pixelYPos;
+        const TileCache::Row& row = m_TileCache.getRow(tileDataAddress + tileDataOffset + 2 * pixelYPos);
 
-        Colour::GBColour c = getGBColour(pixelXPos, tileAddress);
-        drawPixel(col, line, c);
+        for(u8 pixelXPos = xPos % TILE_WIDTH; pixelXPos < TILE_WIDTH && col < SCREEN_WIDTH; ++pixelXPos)
+        {
+            drawPixel(col++, line, static_cast<Colour::GBColour>(row[pixelXPos]), palette);
+            xPos++;
+        }
     }
 }
 
@@ -283,6 +329,7 @@ void PPU::drawSprites(u8 line)
         u8 tileDataAddress = m_Gameboy.read(OAM_START_ADDR + spriteIndex + 2);
         u8 attributes      = m_Gameboy.read(OAM_START_ADDR + spriteIndex + 3);
 
+        bool obp1       = bit_functions::get_bit(attributes, 4);
         bool xFlip      = bit_functions::get_bit(attributes, 5);
         bool yFlip      = bit_functions::get_bit(attributes, 6);
         bool bgPriority = bit_functions::get_bit(attributes, 7);
@@ -297,19 +344,15 @@ void PPU::drawSprites(u8 line)
         // skip sprites that don't need to be rendered
         if(line < spriteYPos || line >= spriteYPos + spriteSize) continue;
 
-        // add 2 bytes/line based on the y offset into the tile
+        // add 2 bytes/line based on the y offset into the tile, and flip the row if needed
         u16 tileAddress = TILE_DATA_HIGH + tileDataAddress * BYTES_PER_TILE + 2 * pixelYPos;
+        const TileCache::Row& row = xFlip ? m_TileCache.getFlippedRow(tileAddress) : m_TileCache.getRow(tileAddress);
+
+        const Colour::PaletteTable& palette = m_Palettes[static_cast<u8>(obp1 ? Colour::Palette::Object1 : Colour::Palette::Object0)];
 
         // Loop over all the pixels in the sprite
         for(u8 x = 0; x < SPRITE_WIDTH; ++x)
         {
-            // And flip the x position if needed
-            u8 pixelXPos = x;
-            if(xFlip)
-            {
-                pixelXPos = SPRITE_WIDTH - 1 - pixelXPos;
-            }
-
             u8 screenXPos = spriteXPos + x;
 
             // Only render pixels visible on the screen.
@@ -320,7 +363,7 @@ void PPU::drawSprites(u8 line)
             // Greater than the screen's width would not, so go to the next sprite
             if(screenXPos >= SCREEN_WIDTH) break;
 
-            Colour::GBColour c = getGBColour(pixelXPos, tileAddress);
+            auto c = static_cast<Colour::GBColour>(row[x]);
 
             // Don't render white pixels, as they're transparent
             if (c == Colour::GBColour::WHITE) continue;
@@ -328,74 +371,12 @@ void PPU::drawSprites(u8 line)
             // Don't draw if the background has priority, unless the colour is white
             if(!bgPriority || getPixel(screenXPos, line) == Colour::GBColour::WHITE)
             {
-                drawPixel(spriteXPos + x, line, c);
+                drawPixel(spriteXPos + x, line, c, palette);
             }
        }
     }
 }
 
-auto PPU::getGBColour(u8 pixelXPos, u16 tileAddress) const -> Colour::GBColour
-{
-    u8 low  = m_Gameboy.read(tileAddress    );
-    u8 high = m_Gameboy.read(tileAddress + 1);
-
-    u8 bit = 7 - pixelXPos;
-    u8 colour = bit_functions::get_bit(low, bit) | (bit_functions::get_bit(high, bit) << 1);
-
-    return static_cast<Colour::GBColour>(colour);
-}
-
-auto PPU::getScreenColour(Colour::GBColour colour) const -> Colour::ScreenColour
-{
-    // TODO: Colour pallets
-
-    Colour::ScreenColour c;
-    switch(colour)
-    {
-        case Colour::GBColour::WHITE:
-            c.red     = 0x9B;
-            c.green   = 0xBC;
-            c.blue    = 0x0F;
-            c.alpha   = 0xFF;
-            break;
-        case Colour::GBColour::LIGHT_GRAY:
-            c.red     = 0x8B;
-            c.green   = 0xAC;
-            c.blue    = 0x0F;
-            c.alpha   = 0xFF;
-            break;
-        case Colour::GBColour::DARK_GRAY:
-            c.red     = 0x30;
-            c.green   = 0x62;
-            c.blue    = 0x30;
-            c.alpha   = 0xFF;
-            break;
-        case Colour::GBColour::BLACK:
-            c.red     = 0x0F;
-            c.green   = 0x38;
-            c.blue    = 0x0F;
-            c.alpha   = 0xFF;
-            break;
-        default:
-            ASSERT(false, "Invalid colour!");
-    }
-
-    return c;
-}
-
-void PPU::drawPixel(u8 x, u8 y, Colour::GBColour c)
-{
-    ASSERT((x + y * SCREEN_WIDTH < COLOUR_BUFFER_SIZE), "INVALID PIXEL POSITION! X: " << (int)x << ", Y: " << (int)y << ", Pos: " << (int)((x + y * SCREEN_WIDTH) * 4));
-    
-    m_ColourBuffer[x + y * SCREEN_WIDTH] = c;
-
-    Colour::ScreenColour sc = getScreenColour(c);
-    m_FrameBuffer[(x + y * SCREEN_WIDTH) * 4    ] = sc.red;
-    m_FrameBuffer[(x + y * SCREEN_WIDTH) * 4 + 1] = sc.green;
-    m_FrameBuffer[(x + y * SCREEN_WIDTH) * 4 + 2] = sc.blue;
-    m_FrameBuffer[(x + y * SCREEN_WIDTH) * 4 + 3] = sc.alpha;
-}
-
 auto PPU::getPixel(u8 x, u8 y) const -> Colour::GBColour
 {
     ASSERT((x + y * SCREEN_WIDTH < COLOUR_BUFFER_SIZE), "INVALID PIXEL POSITION! X: " << (int)x << ", Y: " << (int)y << ", Pos: " << (int)((x + y * SCREEN_WIDTH) * 4));
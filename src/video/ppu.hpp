@@ -3,8 +3,10 @@
 #include "core.hpp"
 
 #include <array>
+#include <cstring>
 #include <functional>
 
+#include "tile_cache.hpp"
 #include "video_defs.hpp"
 
 class Gameboy;
@@ -17,9 +19,24 @@ class PPU
         /**
          * @brief Sets the callback function for when the screen is ready to be drawn
          * 
-         * @param callback The callback function to be called
+         * @param callback The callback function to be called with the completed frame
          */
-        void setDrawCallback(std::function<void(std::array<u8, FRAME_BUFFER_SIZE> buffer)> callback);
+        void setDrawCallback(std::function<void(Frame frame)> callback);
+
+        /**
+         * @brief Gets the last completed frame
+         * 
+         * @return The frame, which stays valid until FRAME_BUFFER_COUNT - 1 more frames
+         * have been completed, as the PPU draws into the other buffers of the ring until then
+         */
+        [[nodiscard]] __always_inline auto getFrame() const -> Frame;
+
+        /**
+         * @brief Gets the number of frames completed since startup
+         * 
+         * @return The number of frames, which changes when a new frame can be borrowed
+         */
+        [[nodiscard]] __always_inline auto getFrameCount() const -> u64;
 
         /**
          * @brief Emulate the PPU for a specified amount of cycles
@@ -34,6 +51,36 @@ class PPU
         **/
         [[nodiscard]] auto getMode() const -> VideoMode;
 
+        /**
+         * @brief Returns the number of cycles until the PPU next changes
+         * mode or line, which is the only time it changes memory
+        **/
+        [[nodiscard]] auto getCyclesUntilEvent() const -> u32;
+
+        /**
+         * @brief Decodes a row of a tile after its tile data was written
+         * 
+         * @param address The address of the row in vram
+         * @param low The first byte of the row
+         * @param high The second byte of the row
+         */
+        __always_inline void updateTile(u16 address, u8 low, u8 high);
+
+        /**
+         * @brief Rebuilds the lookup table of a palette after its register was written
+         * 
+         * @param palette The palette
+         * @param value The value of BGP, OBP0 or OBP1
+         */
+        void setPalette(Colour::Palette palette, u8 value);
+
+        /**
+         * @brief Sets the host colours the shades are shown as, and rebuilds the palettes
+         * 
+         * @param scheme The colour scheme
+         */
+        void setColourScheme(Colour::Scheme scheme);
+
     private:
         /**
          * @brief Draw a background line to the screen
@@ -56,24 +103,15 @@ class PPU
         void drawSprites(u8 line);
 
         /**
-         * @brief Get the gameboy colour of a pixel within a tile
-         * 
-         * @param pixelXPos The x position of the pixel within
-         * the tile
-         * 
-         * @param tileAddress The address of the tile to get the
-         * colour information from
-         * @return The Gameboy colour at the x position of the tile
-         */
-        auto getGBColour(u8 pixelXPos, u16 tileAddress) const -> Colour::GBColour;
-
-        /**
-         * @brief Convert a GB Colour into a screen colour
+         * @brief Draw a line of a tile map to the screen, a tile row at a time
          * 
-         * @param colour The colour of the gb colour to convert into a screen colour
-         * @return The screen colour at the pixel
+         * @param line The line of the screen to draw
+         * @param tileMapAddress The address of the tile map
+         * @param tileDataAddress The address of the tile data the map indexes
+         * @param scrollX The x position in the tile map of the left of the screen
+         * @param scrollY The y position in the tile map of the top of the screen
          */
-        auto getScreenColour(Colour::GBColour colour) const -> Colour::ScreenColour;
+        void drawTileMapLine(u8 line, u16 tileMapAddress, u16 tileDataAddress, u8 scrollX, u8 scrollY);
 
         /**
          * @brief Draw a specified pixel at position (x, y) with
@@ -84,8 +122,10 @@ class PPU
          * @param y The y coordinate of the pixel
          *
          * @param c The colour of the pixel
+         * 
+         * @param palette The palette the colour is shown through
          */
-        void drawPixel(u8 x, u8 y, Colour::GBColour);
+        __always_inline void drawPixel(u8 x, u8 y, Colour::GBColour c, const Colour::PaletteTable& palette);
 
         /**
          * @brief Get the colour of a pixel on the screen
@@ -100,10 +140,48 @@ class PPU
         Gameboy& m_Gameboy;
 
         std::array<Colour::GBColour, COLOUR_BUFFER_SIZE> m_ColourBuffer {{}};
-        std::array<u8,               FRAME_BUFFER_SIZE>  m_FrameBuffer  {{}};
-        std::function<void(std::array<u8, FRAME_BUFFER_SIZE> buffer)> m_DrawCallback;
+        std::function<void(Frame frame)> m_DrawCallback;
+
+        // The frames are drawn in turn, so a completed one is handed off without being copied
+        std::array<std::array<u8, FRAME_BUFFER_SIZE>, FRAME_BUFFER_COUNT> m_FrameBuffers {{}};
+        u8  m_DrawIndex;
+        u8  m_FrameIndex;
+        u64 m_FrameCount;
+
+        TileCache m_TileCache;
+
+        Colour::PaletteTable m_Scheme;
+        std::array<u8,                   static_cast<u8>(Colour::Palette::Count)> m_PaletteValues;
+        std::array<Colour::PaletteTable, static_cast<u8>(Colour::Palette::Count)> m_Palettes;
 
         VideoMode m_Mode;
         u16 m_Cycles;
         u8 m_Line;
 };
+
+//--------------------------  Inline function implementations --------------------------//
+
+__always_inline void PPU::updateTile(u16 address, u8 low, u8 high)
+{
+    m_TileCache.update(address, low, high);
+}
+
+__always_inline auto PPU::getFrame() const -> Frame
+{
+    return m_FrameBuffers[m_FrameIndex];
+}
+
+__always_inline auto PPU::getFrameCount() const -> u64
+{
+    return m_FrameCount;
+}
+
+__always_inline void PPU::drawPixel(u8 x, u8 y, Colour::GBColour c, const Colour::PaletteTable& palette)
+{
+    ASSERT((x + y * SCREEN_WIDTH < COLOUR_BUFFER_SIZE), "INVALID PIXEL POSITION! X: " << (int)x << ", Y: " << (int)y << ", Pos: " << (int)((x + y * SCREEN_WIDTH) * 4));
+
+    m_ColourBuffer[x + y * SCREEN_WIDTH] = c;
+
+    // A single 32 bit store of the whole RGBA pixel
+    std::memcpy(&m_FrameBuffers[m_DrawIndex][(x + y * SCREEN_WIDTH) * 4], &palette[c], sizeof(u32));
+}
@@ -51,9 +51,9 @@ Screen::~Screen()
     SDL_DestroyWindow(m_Window);
 }
 
-void Screen::draw(const std::array<u8, FRAME_BUFFER_SIZE>& buffer)
+void Screen::draw(Frame frame)
 {
-    SDL_UpdateTexture(m_Texture, nullptr, buffer.data(), SCREEN_WIDTH * 4);
+    SDL_UpdateTexture(m_Texture, nullptr, frame.data(), SCREEN_WIDTH * 4);
     SDL_RenderCopy(m_Renderer, m_Texture, nullptr, nullptr);
     SDL_RenderPresent(m_Renderer);
 }
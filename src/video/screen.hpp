@@ -4,6 +4,8 @@
 
 #include <array>
 
+#include "video_defs.hpp"
+
 #include <SDL2/SDL.h>
 
 class Gameboy;
@@ -27,11 +29,11 @@ class Screen
         ~Screen();
 
         /**
-         * @brief Draws the buffer to the screen
+         * @brief Draws a frame to the screen
          * 
-         * @param buffer The buffer to draw
+         * @param frame The frame to draw, which is only borrowed for the call
          */
-        void draw(const std::array<u8, FRAME_BUFFER_SIZE>& buffer);
+        void draw(Frame frame);
 
         /**
          * @brief Set the title of the window
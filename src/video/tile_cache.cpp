@@ -0,0 +1,55 @@
+#include "core.hpp"
+
+#include "tile_cache.hpp"
+
+#include <bit>
+
+// Spreads the bits of a bitplane over the bytes of a row, the leftmost pixel (bit 7) first
+constexpr auto EXPAND = []
+{
+    std::array<u64, 0x100> table {};
+    for(u32 byte = 0; byte < table.size(); ++byte)
+    {
+        TileCache::Row row {};
+        for(u8 x = 0; x < TILE_WIDTH; ++x)
+        {
+            row[x] = (byte >> (7 - x)) & 1;
+        }
+
+        table[byte] = std::bit_cast<u64>(row);
+    }
+
+    return table;
+}();
+
+// Reverses the bits of a bitplane, which mirrors it for x flipped sprites
+constexpr auto REVERSE = []
+{
+    std::array<u8, 0x100> table {};
+    for(u32 byte = 0; byte < table.size(); ++byte)
+    {
+        for(u8 bit = 0; bit < 8; ++bit)
+        {
+            table[byte] |= ((byte >> bit) & 1) << (7 - bit);
+        }
+    }
+
+    return table;
+}();
+
+TileCache::TileCache()
+    : m_Tiles({}), m_FlippedTiles({})
+{
+    DEBUG("Initializing Tile Cache.");
+}
+
+void TileCache::update(u16 address, u8 low, u8 high)
+{
+    u16 offset = address - TILE_DATA_HIGH;
+    u16 tile   = offset / BYTES_PER_TILE;
+    u8  row    = (offset % BYTES_PER_TILE) / 2;
+
+    // All 8 pixels at once, the high bitplane holds the high bit of each colour
+    m_Tiles[tile][row]        = std::bit_cast<Row>(EXPAND[low] | EXPAND[high] << 1);
+    m_FlippedTiles[tile][row] = std::bit_cast<Row>(EXPAND[REVERSE[low]] | EXPAND[REVERSE[high]] << 1);
+}
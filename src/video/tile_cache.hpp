@@ -0,0 +1,60 @@
+#pragma once
+
+#include "core.hpp"
+
+#include <array>
+
+/**
+ * The tile data in vram, decoded into one 2 bit colour index per pixel. It is
+ * kept up to date by the MMU whenever tile data is written, so the PPU never
+ * has to decode the bitplanes itself.
+**/
+class TileCache
+{
+    public:
+        using Row = std::array<u8, TILE_WIDTH>;
+    public:
+        TileCache();
+
+        /**
+         * @brief Decodes a row of a tile after one of its bytes was written
+         * 
+         * @param address The address of the row in vram
+         * @param low The first byte of the row, holding the low bits of the colours
+         * @param high The second byte of the row, holding the high bits of the colours
+         */
+        void update(u16 address, u8 low, u8 high);
+
+        /**
+         * @brief Gets a decoded row of a tile
+         * 
+         * @param address The address of the row in vram, like the PPU would read it from
+         * @return The colour indices of the row's pixels, from left to right
+         */
+        [[nodiscard]] __always_inline auto getRow(u16 address) const -> const Row&;
+
+        /**
+         * @brief Gets a decoded row of a tile, mirrored for x flipped sprites
+         * 
+         * @param address The address of the row in vram, like the PPU would read it from
+         * @return The colour indices of the row's pixels, from right to left
+         */
+        [[nodiscard]] __always_inline auto getFlippedRow(u16 address) const -> const Row&;
+    private:
+        std::array<std::array<Row, TILE_HEIGHT>, TILE_COUNT> m_Tiles;
+        std::array<std::array<Row, TILE_HEIGHT>, TILE_COUNT> m_FlippedTiles;
+};
+
+//--------------------------  Inline function implementations --------------------------//
+
+__always_inline auto TileCache::getRow(u16 address) const -> const Row&
+{
+    u16 offset = address - TILE_DATA_HIGH;
+    return m_Tiles[offset / BYTES_PER_TILE][(offset % BYTES_PER_TILE) / 2];
+}
+
+__always_inline auto TileCache::getFlippedRow(u16 address) const -> const Row&
+{
+    u16 offset = address - TILE_DATA_HIGH;
+    return m_FlippedTiles[offset / BYTES_PER_TILE][(offset % BYTES_PER_TILE) / 2];
+}
@@ -2,8 +2,15 @@
 
 #include "core.hpp"
 
+#include <array>
+#include <bit>
+#include <span>
+
 // TODO: Maybe move colour to its own file?
 
+// The RGBA pixels of a completed frame, borrowed from the PPU's frame ring
+using Frame = std::span<const u8, FRAME_BUFFER_SIZE>;
+
 enum class VideoMode
 {
     HBlank,     // Mode 0
@@ -29,6 +36,37 @@ namespace Colour
         u8 blue;
         u8 alpha;
     };
+
+    // The palettes the PPU maps colours through, set by BGP, OBP0 and OBP1
+    enum class Palette : u8
+    {
+        Background,
+        Object0,
+        Object1,
+        Count
+    };
+
+    // The host colours the four shades are shown as
+    enum class Scheme : u8
+    {
+        Green,
+        Gray,
+        Pocket
+    };
+
+    // The RGBA pixels of a palette's colours, as they're stored in the frame buffer
+    using PaletteTable = std::array<u32, 4>;
+
+    /**
+     * @brief Packs a screen colour into a frame buffer pixel
+     * 
+     * @param colour The screen colour
+     * @return The pixel, with its bytes in RGBA order in memory
+     */
+    constexpr auto toPixel(ScreenColour colour) -> u32
+    {
+        return std::bit_cast<u32>(colour);
+    }
 }
 
 